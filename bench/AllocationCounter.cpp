@@ -0,0 +1,70 @@
+/**
+ * @file AllocationCounter.cpp
+ * @brief   operator new/delete  
+ *
+ * @details   operator new    
+ *  operator delete:  -  malloc/free,  -
+ *  aligned_alloc/free (_aligned_malloc/_aligned_free  Windows).
+ *  nothrow      .
+ */
+
+#include "AllocationCounter.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace {
+
+    std::atomic<std::uint64_t> allocations{ 0 }; ///<  operator new   
+
+    void* allocate(std::size_t size) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        if (void* p = std::malloc(size != 0 ? size : 1)) return p;
+        throw std::bad_alloc();
+    }
+
+    void* allocate_aligned(std::size_t size, std::align_val_t alignment) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        const auto align = static_cast<std::size_t>(alignment);
+        if (size == 0) size = 1;
+#ifdef _WIN32
+        void* p = _aligned_malloc(size, align);
+#else
+        // aligned_alloc  ,  
+        void* p = std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+        if (p) return p;
+        throw std::bad_alloc();
+    }
+
+    void release_aligned(void* p) noexcept {
+#ifdef _WIN32
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+
+} // namespace
+
+std::uint64_t allocation_count() {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size) { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) { return allocate_aligned(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return allocate_aligned(size, alignment); }
+void operator delete(void* p, std::align_val_t) noexcept { release_aligned(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { release_aligned(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { release_aligned(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { release_aligned(p); }
@@ -0,0 +1,19 @@
+/**
+ * @file AllocationCounter.hpp
+ * @brief     
+ *
+ * @details AllocationCounter.cpp   operator new 
+ * operator delete   (  ,   
+ * )    operator new    .
+ *      :   
+ * .       .
+ */
+
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief   operator new   
+ * @note 
+ */
+std::uint64_t allocation_count();
@@ -0,0 +1,125 @@
+/**
+ * @file LedgerGenerator.cpp
+ * @brief    
+ */
+
+#include "LedgerGenerator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace {
+
+    /**
+     * @brief   : 1 / (k + 1)^s
+     * @param count  
+     * @param skew  s (0 -  )
+     */
+    std::discrete_distribution<size_t> zipf(size_t count, double skew) {
+        std::vector<double> weights(std::max<size_t>(count, 1));
+        for (size_t k = 0; k < weights.size(); ++k) {
+            weights[k] = 1.0 / std::pow(static_cast<double>(k + 1), skew);
+        }
+        return std::discrete_distribution<size_t>(weights.begin(), weights.end());
+    }
+
+    /**
+     * @brief     
+     * @param size  
+     *
+     * @details  k -  k     
+     *  ,    
+     */
+    std::vector<std::string> build_vocabulary(size_t size) {
+        static const std::vector<std::string> syllables = {
+            "", "", "", "", "", "", "", "", "", "",
+            "", "", "", "", "", "", "", "", "", ""
+        };
+        std::vector<std::string> words;
+        words.reserve(size);
+        for (size_t k = 0; k < size; ++k) {
+            std::string word;
+            size_t n = k;
+            do {
+                word += syllables[n % syllables.size()];
+                n /= syllables.size();
+            } while (n > 0);
+            words.push_back(std::move(word));
+        }
+        return words;
+    }
+
+} // namespace
+
+LedgerData generate_ledger(const LedgerGeneratorConfig& config) {
+    static const std::vector<std::string> expense_categories = {
+        "", "", "", "", "", "", "", ""
+    };
+    static const std::vector<std::string> income_categories = { "", "", "" };
+    const auto& tags = Transaction::get_available_tags();
+    const std::vector<std::string> vocabulary = build_vocabulary(config.vocabulary);
+
+    const size_t account_count = std::max<size_t>(config.accounts, 1);
+    std::mt19937_64 rng(config.seed);
+    auto account_of = zipf(account_count, config.account_skew);
+    auto tag_of = zipf(tags.size(), config.tag_skew);
+    auto word_of = zipf(vocabulary.size(), 1.0);
+    std::vector<double> currency_weights;
+    for (const auto& [code, weight] : config.currencies) currency_weights.push_back(weight);
+    std::discrete_distribution<size_t> currency_of(currency_weights.begin(), currency_weights.end());
+    std::poisson_distribution<size_t> tag_count(config.tags_per_transaction);
+    std::uniform_int_distribution<size_t> word_count(1, std::max<size_t>(config.max_words, 1));
+    std::lognormal_distribution<double> amount(6.0, 1.2);
+    std::bernoulli_distribution income(config.income_share);
+    std::bernoulli_distribution quoted(config.quoted_share);
+    std::uniform_int_distribution<int> year(config.first_year, config.first_year + std::max(config.years, 1) - 1);
+    std::uniform_int_distribution<int> month(1, 12);
+    std::uniform_int_distribution<int> day(1, 28);
+
+    LedgerData data;
+    std::vector<TransactionStore*> buckets;
+    //    - "":     FinanceCore
+    for (size_t a = 0; a < account_count; ++a) {
+        buckets.push_back(&data.accounts[a == 0 ? std::string("") : " " + std::to_string(a + 1)]);
+    }
+    for (auto* bucket : buckets) {
+        bucket->reserve(config.rows / account_count + 1);
+    }
+
+    std::string description;
+    for (size_t i = 0; i < config.rows; ++i) {
+        description.clear();
+        for (size_t w = word_count(rng); w > 0; --w) {
+            if (!description.empty()) description += ' ';
+            description += vocabulary[word_of(rng)];
+        }
+        if (quoted(rng)) description = " \"" + description + "\", ";
+
+        const bool is_income = income(rng);
+        const auto& categories = is_income ? income_categories : expense_categories;
+        const double value = std::round(std::max(0.01, amount(rng)) * 100.0) / 100.0;
+
+        Transaction t(value, categories[rng() % categories.size()],
+            is_income ? Transaction::Type::INCOME : Transaction::Type::EXPENSE,
+            Date(year(rng), month(rng), day(rng)), description);
+        t.set_currency(config.currencies.empty() ? "RUB" : config.currencies[currency_of(rng)].first);
+        for (size_t k = std::min(tag_count(rng), config.max_tags); k > 0; --k) {
+            const auto& tag = tags[tag_of(rng)];
+            if (!t.has_tag(tag)) t.add_tag(tag);
+        }
+        data.max_id = std::max(data.max_id, t.get_id());
+        buckets[account_of(rng)]->push_back(t);
+    }
+    return data;
+}
+
+std::map<std::string, Account> generate_accounts(const LedgerGeneratorConfig& config) {
+    LedgerData data = generate_ledger(config);
+    std::map<std::string, Account> accounts;
+    for (auto& [name, transactions] : data.accounts) {
+        auto [it, inserted] = accounts.emplace(std::piecewise_construct,
+            std::forward_as_tuple(name), std::forward_as_tuple(name));
+        it->second.assign_transactions(std::move(transactions));
+    }
+    return accounts;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file LedgerGenerator.hpp
+ * @brief      
+ *
+ * @details    :
+ * -    ( ):  
+ *       
+ * -     
+ * - :    (  max_tags),  
+ *     (     )
+ * -    :    
+ *   ,        CSV
+ *
+ *   seed  .
+ */
+
+#pragma once
+#include "Account.hpp"
+#include "storage/LedgerData.hpp"
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+ /**
+  * @struct LedgerGeneratorConfig
+  * @brief   
+  */
+struct LedgerGeneratorConfig {
+    size_t rows = 1000000;   ///<  
+    size_t accounts = 24;    ///<  
+    double account_skew = 1.0; ///<      (0 - )
+
+    ///     ()
+    std::vector<std::pair<std::string, double>> currencies = {
+        { "RUB", 0.70 }, { "USD", 0.15 }, { "EUR", 0.10 }, { "CNY", 0.05 }
+    };
+
+    double income_share = 0.25;  ///<  
+    double tags_per_transaction = 0.8; ///<   
+    size_t max_tags = 5;         ///<   (   Transaction)
+    double tag_skew = 1.0;       ///<     
+    size_t vocabulary = 5000;    ///<   
+    size_t max_words = 4;        ///<    
+    double quoted_share = 1.0 / 16; ///<      
+    int first_year = 2015;       ///<   
+    int years = 10;              ///<  
+    std::uint32_t seed = 42;     ///<  
+};
+
+/**
+ * @brief  
+ * @param config 
+ * @return   ; max_id -   ID
+ *
+ * @note   ID     (IdAllocator)
+ */
+LedgerData generate_ledger(const LedgerGeneratorConfig& config);
+
+/**
+ * @brief      
+ * @param config 
+ * @return    (  )
+ */
+std::map<std::string, Account> generate_accounts(const LedgerGeneratorConfig& config);
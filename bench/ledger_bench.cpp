@@ -0,0 +1,271 @@
+/**
+ * @file ledger_bench.cpp
+ * @brief   FinanceCore   
+ *
+ * @details    :
+ * 1.   (LedgerGenerator)     transactions.dat
+ * 2.  FinanceCore   :  
+ *     CSV     
+ * 3.    ( ),  
+ *     (validateData),  ,  
+ *    Statistics.cpp,   ,    
+ * 4.       (operator new
+ *       AllocationCounter.cpp;  
+ *     )
+ * 5.    JSON,     
+ *
+ *  FinanceCore    ,  
+ * (" Enter")    .
+ *
+ * @par :
+ * @code
+ * ledger_bench [--accounts=N] [--seed=N] [--out=file.json] [rows...]
+ * ledger_bench 10000 100000 1000000 10000000 50000000
+ * @endcode
+ *  : 10000 100000 1000000.  50   
+ *  20  .
+ */
+
+#include "AllocationCounter.hpp"
+#include "FinanceCore.hpp"
+#include "LedgerGenerator.hpp"
+#include "storage/CsvTokenizer.hpp"
+#include "storage/LedgerCsv.hpp"
+#include "../libs/json.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    /**
+     * @brief ,  
+     */
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override { return traits_type::not_eof(c); }
+        std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+    };
+
+    /**
+     * @brief  std::cout  std::cin    
+     */
+    class QuietConsole {
+    public:
+        QuietConsole() : input_(std::string(64, '\n')),
+            out_(std::cout.rdbuf(&null_)), in_(std::cin.rdbuf(input_.rdbuf())) {}
+        ~QuietConsole() {
+            std::cout.rdbuf(out_);
+            std::cin.rdbuf(in_);
+            std::cin.clear();
+        }
+
+    private:
+        NullBuffer null_;
+        std::istringstream input_;
+        std::streambuf* out_;
+        std::streambuf* in_;
+    };
+
+    /**
+     * @brief    
+     * @return   
+     */
+    template <typename F>
+    double time_ms(F&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /**
+     * @brief   :     
+     */
+    struct Probe {
+        nlohmann::json& timings;     ///<   
+        nlohmann::json& allocations; ///<    
+
+        template <typename F>
+        void operator()(const char* name, F&& fn) {
+            const std::uint64_t before = allocation_count();
+            timings[name] = time_ms(std::forward<F>(fn));
+            allocations[name] = allocation_count() - before;
+        }
+    };
+
+    /**
+     * @brief   -:     
+     */
+    void write_rates(const std::filesystem::path& dir) {
+        std::filesystem::create_directories(dir / "CurrencyDat");
+        std::ofstream(dir / "CurrencyDat" / "currency_rates.json")
+            << R"({ "RUB": 1.0, "USD": 90.0, "EUR": 98.0, "CNY": 12.5 })";
+    }
+
+    /**
+     * @brief     
+     */
+    void remove_ledger(const std::filesystem::path& data_path) {
+        std::error_code ec;
+        for (const char* ext : { ".dat", ".snap", ".journal" }) {
+            std::filesystem::remove(std::filesystem::path(data_path).replace_extension(ext), ec);
+        }
+        std::filesystem::remove_all(std::filesystem::path(data_path).replace_extension(".ledger"), ec);
+    }
+
+    /**
+     * @brief   
+     * @return   JSON
+     */
+    nlohmann::json run(const LedgerGeneratorConfig& config, const std::filesystem::path& data_path) {
+        nlohmann::json result;
+        result["rows"] = config.rows;
+        result["accounts"] = config.accounts;
+        Probe measure{ result["timings_ms"], result["allocations"] };
+
+        remove_ledger(data_path);
+        measure("generate", [&] {
+            auto accounts = generate_accounts(config);
+            std::ofstream csv(data_path, std::ios::binary);
+            LedgerCsv::write(csv, accounts);
+            });
+        result["csv_bytes"] = std::filesystem::file_size(data_path);
+
+        QuietConsole quiet;
+        std::unique_ptr<FinanceCore> core;
+        measure("load_csv", [&] { core = std::make_unique<FinanceCore>(data_path); });
+        measure("load_index", [&] { core->loadData(); });
+
+        bool valid = false;
+        measure("materialize_all", [&] { valid = core->validateData(); });
+        result["balances_valid"] = valid;
+        measure("recalculate_balance", [&] { core->recalculateBalances(); });
+
+        measure("show_total_balance", [&] { core->showTotalBalance(); });
+        measure("show_by_category", [&] { core->showByCategory(); });
+        measure("show_by_month", [&] { core->showByMonth(); });
+        measure("show_current_account_stats", [&] { core->showCurrentAccountStats(); });
+        measure("show_balance_by_currency", [&] { core->showBalanceByCurrency(); });
+        const std::vector<std::string> tags = { Transaction::get_available_tags().front() };
+        measure("search_by_tags", [&] { core->searchByTags(tags); });
+        measure("view_income", [&] { core->viewIncome(); });
+        measure("view_all_transactions", [&] { core->viewAllTransactions(); });
+        measure("transactions_between", [&] {
+            core->getCurrentAccount().transactions_between(Date(config.first_year, 3, 1), Date(config.first_year, 3, 31));
+            });
+
+        {
+            //        
+            const Date first(config.first_year, 1, 1);
+            const Date last(config.first_year + config.years - 1, 12, 31);
+            RateHistory daily;
+            for (std::int32_t day = first.day_number(); day <= last.day_number(); ++day) {
+                const double drift = 1.0 + 0.0001 * (day - first.day_number());
+                daily.record(Date::from_day_number(day),
+                    { { "RUB", 1.0 }, { "USD", 60.0 * drift }, { "EUR", 70.0 * drift }, { "CNY", 9.0 * drift } });
+            }
+            const std::string history_path = std::filesystem::path(data_path).replace_extension(".rates").string();
+            daily.save(history_path);
+
+            CurrencyConverter converter;
+            measure("load_rate_history", [&] { converter.load_history_from_file(history_path); });
+            std::filesystem::remove(history_path);
+            converter.set_rates({ { "RUB", 1.0 }, { "USD", 90.0 }, { "EUR", 98.0 }, { "CNY", 12.5 } });
+
+            const TransactionSelection history = core->getCurrentAccount().transactions_between(first, last);
+            std::vector<std::int64_t> amounts;
+            std::vector<Symbol> currencies;
+            std::vector<Date> dates;
+            amounts.reserve(history.size());
+            currencies.reserve(history.size());
+            dates.reserve(history.size());
+            for (const auto& t : history) {
+                amounts.push_back(t.get_amount().minor_units());
+                currencies.push_back(t.get_currency_symbol());
+                dates.push_back(t.get_date());
+            }
+            std::vector<double> rub(amounts.size());
+            measure("convert_at_dates", [&] {
+                converter.convert(amounts.data(), currencies.data(), dates.data(), amounts.size(), Symbol("RUB"), rub.data());
+                });
+        }
+
+        measure("save_unchanged", [&] { core->saveData(); });
+        core->getCurrentAccount().addTransaction(
+            Transaction(100.0, "", Transaction::Type::EXPENSE, Date(2024, 1, 1), "ledger_bench"));
+        measure("save_one_account", [&] { core->saveData(); });
+
+        core.reset();
+        remove_ledger(data_path);
+        return result;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    LedgerGeneratorConfig config;
+    std::vector<size_t> sizes;
+    std::string out_path;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg.rfind("--accounts=", 0) == 0) config.accounts = std::strtoull(arg.c_str() + 11, nullptr, 10);
+        else if (arg.rfind("--seed=", 0) == 0) config.seed = static_cast<std::uint32_t>(std::strtoul(arg.c_str() + 7, nullptr, 10));
+        else if (arg.rfind("--out=", 0) == 0) out_path = std::filesystem::absolute(arg.substr(6)).string();
+        else sizes.push_back(std::strtoull(arg.c_str(), nullptr, 10));
+    }
+    if (sizes.empty()) sizes = { 10000, 100000, 1000000 };
+
+    const auto dir = std::filesystem::temp_directory_path() / "money_keeper_ledger_bench";
+    std::filesystem::create_directories(dir);
+    write_rates(dir);
+    //   FinanceCore    
+    std::filesystem::current_path(dir);
+
+    nlohmann::json report;
+    report["benchmark"] = "ledger_bench";
+    report["format_version"] = 1;
+    report["environment"] = {
+        { "hardware_threads", std::thread::hardware_concurrency() },
+        { "isa", CsvTokenizer::isa() },
+#ifdef NDEBUG
+        { "build", "release" },
+#else
+        { "build", "debug" },
+#endif
+    };
+    report["config"] = {
+        { "seed", config.seed },
+        { "account_skew", config.account_skew },
+        { "income_share", config.income_share },
+        { "tags_per_transaction", config.tags_per_transaction },
+        { "vocabulary", config.vocabulary },
+    };
+    report["results"] = nlohmann::json::array();
+
+    for (size_t rows : sizes) {
+        config.rows = rows;
+        std::cerr << "ledger_bench: " << rows << " rows...\n";
+        try {
+            report["results"].push_back(run(config, dir / "transactions.dat"));
+        }
+        catch (const std::exception& e) {
+            std::cerr << "ledger_bench: " << rows << " rows failed: " << e.what() << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (out_path.empty()) {
+        std::cout << report.dump(2) << "\n";
+    }
+    else {
+        std::ofstream(out_path) << report.dump(2) << "\n";
+    }
+    return EXIT_SUCCESS;
+}
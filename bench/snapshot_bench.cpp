@@ -0,0 +1,211 @@
+/**
+ * @file snapshot_bench.cpp
+ * @brief    CSV   
+ *
+ * @details    :
+ * 1.     
+ * 2.    CSV (LedgerCsv)    (LedgerSnapshot)
+ * 3.     :  +   Account
+ *    - csv: std::ifstream + LedgerCsv::read
+ *    - mmap: MappedFile + LedgerCsv::parse
+ *    - mmap-mt: MappedFile + LedgerCsv::parse_parallel ( )
+ *    - binary: LedgerSnapshot::read
+ * 4.     CSV   (CsvTokenizer), /
+ * 5.     (SegmentStore):  
+ *         
+ * 6.   :   
+ *        (  )
+ *
+ * @par :
+ * @code
+ * snapshot_bench [rows...]     #   1000000 10000000
+ * @endcode
+ */
+
+#include "Account.hpp"
+#include "LedgerGenerator.hpp"
+#include "storage/CsvTokenizer.hpp"
+#include "storage/LedgerCsv.hpp"
+#include "storage/LedgerSnapshot.hpp"
+#include "storage/MappedFile.hpp"
+#include "storage/SegmentStore.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+namespace {
+
+    constexpr int ACCOUNT_COUNT = 24; ///<     
+
+    /**
+     * @brief    
+     * @param rows   
+     * @return    (. LedgerGenerator)
+     */
+    std::map<std::string, Account> generate(size_t rows) {
+        LedgerGeneratorConfig config;
+        config.rows = rows;
+        config.accounts = ACCOUNT_COUNT;
+        config.account_skew = 0.0;
+        return generate_accounts(config);
+    }
+
+    /**
+     * @brief  LedgerData    ,  FinanceCore::installLedger
+     * @param data  
+     * @return   
+     */
+    size_t install(LedgerData&& data) {
+        std::map<std::string, Account> accounts;
+        size_t total = 0;
+        for (auto& [name, transactions] : data.accounts) {
+            total += transactions.size();
+            auto [it, inserted] = accounts.emplace(std::piecewise_construct,
+                std::forward_as_tuple(name), std::forward_as_tuple(name));
+            it->second.assign_transactions(std::move(transactions));
+        }
+        return total;
+    }
+
+    /**
+     * @brief    
+     * @return   
+     */
+    template <typename F>
+    double time_ms(F&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i) sizes.push_back(std::strtoull(argv[i], nullptr, 10));
+    if (sizes.empty()) sizes = { 1000000, 10000000 };
+
+    const auto dir = std::filesystem::temp_directory_path() / "money_keeper_bench";
+    std::filesystem::create_directories(dir);
+    const std::string csv_path = (dir / "transactions.dat").string();
+    const std::string snap_path = (dir / "transactions.snap").string();
+    const std::string ledger_dir = (dir / "transactions.ledger").string();
+
+    std::cout << std::left << std::setw(10) << "rows"
+        << std::setw(8) << "format" << std::right
+        << std::setw(12) << "size, MB"
+        << std::setw(12) << "load, ms"
+        << std::setw(14) << "rows/s"
+        << std::setw(10) << "speedup" << "\n";
+
+    for (size_t rows : sizes) {
+        std::string segment_report;
+        {
+            auto accounts = generate(rows);
+            std::ofstream csv(csv_path);
+            LedgerCsv::write(csv, accounts);
+            LedgerSnapshot::write(snap_path, accounts);
+
+            auto capture = [&accounts] {
+                LedgerView view;
+                for (const auto& [name, account] : accounts) {
+                    view.accounts.push_back({ name, account.snapshot(), account.generation() });
+                }
+                return view;
+            };
+            std::filesystem::remove_all(ledger_dir);
+            SegmentStore store(ledger_dir);
+            SegmentStore::WriteStats full, incremental;
+            double full_ms = time_ms([&] { full = store.write(capture()); });
+            accounts.begin()->second.addTransaction(
+                Transaction(10.0, "", Transaction::Type::EXPENSE, Date(2024, 1, 1)));
+            double incremental_ms = time_ms([&] { incremental = store.write(capture()); });
+
+            size_t eager_rows = 0;
+            size_t index_rows = 0;
+            double eager_ms = time_ms([&] {
+                SegmentStore reader(ledger_dir);
+                eager_rows = reader.read().transaction_count();
+                });
+            double index_ms = time_ms([&] {
+                SegmentStore reader(ledger_dir);
+                for (const auto& entry : reader.read_index().accounts) index_rows += entry.transactions;
+                });
+            if (eager_rows != index_rows) {
+                std::cerr << "segment row count mismatch: read=" << eager_rows << " index=" << index_rows << "\n";
+                return EXIT_FAILURE;
+            }
+
+            std::ostringstream report;
+            report << std::fixed << std::setprecision(1) << "segments (" << rows << " rows, "
+                << ACCOUNT_COUNT << " accounts): full save " << full_ms << " ms ("
+                << full.written << " written), one account changed " << incremental_ms << " ms ("
+                << incremental.written << " written, " << incremental.reused << " reused); open "
+                << eager_ms << " ms, index only " << std::setprecision(3) << index_ms << " ms";
+            segment_report = report.str();
+        }
+
+        size_t csv_rows = 0;
+        size_t mmap_rows = 0;
+        size_t parallel_rows = 0;
+        size_t snap_rows = 0;
+        double csv_ms = time_ms([&] {
+            std::ifstream file(csv_path);
+            csv_rows = install(LedgerCsv::read(file));
+            });
+        double mmap_ms = time_ms([&] {
+            MappedFile file(csv_path, MappedFile::Access::Sequential);
+            mmap_rows = install(LedgerCsv::parse(file.view()));
+            });
+        double parallel_ms = time_ms([&] {
+            MappedFile file(csv_path, MappedFile::Access::Sequential);
+            parallel_rows = install(LedgerCsv::parse_parallel(file.view()));
+            });
+        double snap_ms = time_ms([&] {
+            snap_rows = install(LedgerSnapshot::read(snap_path));
+            });
+
+        if (csv_rows != rows || mmap_rows != rows || parallel_rows != rows || snap_rows != rows) {
+            std::cerr << "row count mismatch: csv=" << csv_rows << " csv-mmap=" << mmap_rows
+                << " csv-parallel=" << parallel_rows << " snapshot=" << snap_rows << "\n";
+            return EXIT_FAILURE;
+        }
+
+        auto report = [rows](const char* format, const std::string& path, double ms, double base_ms) {
+            std::cout << std::left << std::setw(10) << rows
+                << std::setw(8) << format << std::right << std::fixed
+                << std::setw(12) << std::setprecision(1) << std::filesystem::file_size(path) / 1048576.0
+                << std::setw(12) << std::setprecision(1) << ms
+                << std::setw(14) << std::setprecision(0) << rows / (ms / 1000.0)
+                << std::setw(9) << std::setprecision(1) << base_ms / ms << "x\n";
+        };
+        report("csv", csv_path, csv_ms, csv_ms);
+        report("mmap", csv_path, mmap_ms, csv_ms);
+        report("mmap-mt", csv_path, parallel_ms, csv_ms);
+        report("binary", snap_path, snap_ms, csv_ms);
+
+        //    :     
+        MappedFile file(csv_path, MappedFile::Access::Sequential);
+        size_t fields_total = 0;
+        double tokenize_ms = 0.0;
+        for (int pass = 0; pass < 3; ++pass) {
+            fields_total = 0;
+            double ms = time_ms([&] {
+                CsvTokenizer csv(file.view());
+                std::vector<std::string_view> fields;
+                while (csv.next(fields)) fields_total += fields.size();
+                });
+            tokenize_ms = (pass == 0) ? ms : std::min(tokenize_ms, ms);
+        }
+        std::cout << "tokenize (" << CsvTokenizer::isa() << "): " << fields_total << " fields, "
+            << std::setprecision(2) << file.view().size() / (tokenize_ms / 1000.0) / 1e9 << " GB/s\n";
+        std::cout << segment_report << "\n";
+    }
+
+    std::filesystem::remove_all(dir);
+    return EXIT_SUCCESS;
+}
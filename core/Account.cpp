@@ -15,35 +15,62 @@
  */
 
 #include "Account.hpp"
+#include "storage/Journal.hpp"
 #include <algorithm>
 
+namespace {
+
+    /**
+     * @brief      
+     * @details       (. add_to_totals)
+     */
+    std::vector<CurrencyTotals> without_empty(std::vector<CurrencyTotals> totals) {
+        totals.erase(std::remove_if(totals.begin(), totals.end(),
+            [](const CurrencyTotals& entry) { return entry.income.is_zero() && entry.expenses.is_zero(); }),
+            totals.end());
+        return totals;
+    }
+
+} // namespace
+
  /**
   * @brief    
   * @param t   
   *
   * @details  :
-  * 1.   ID 
-  * 2.    
-  * 3.  
+  * 1.   ID   -
+  * 2.     ( )
+  * 3.       
+  * 4.      
   *
   * @throws std::invalid_argument :
   * -    ID  
   * -    
   *
   * @note  
-  * @complexity O(n)   
+  * @complexity O(1)  
   */
 void Account::addTransaction(const Transaction& t) {
+    std::shared_lock<std::shared_mutex> cut;
+    if (journal_) cut = journal_->apply_guard();
     std::lock_guard<std::mutex> lock(transactions_mutex);
 
-    //    ID
-    if (std::any_of(transactions.begin(), transactions.end(),
-        [&t](const auto& existing) { return existing.get_id() == t.get_id(); })) {
+    //    ID (   )
+    load_locked();
+    if (index_.find(t.get_id()) != IdIndex::NONE) {
         throw std::invalid_argument("Transaction ID already exists");
     }
 
-    transactions.push_back(t);
-    balance += t.get_signed_amount();
+    if (journal_) journal_->log_add(name, t);
+    auto& list = writable_transactions();
+    list.push_back(t);
+    const auto row = static_cast<std::uint32_t>(list.size() - 1);
+    index_.insert(t.get_id(), row);
+    by_date_.insert(row, list.dates());
+    add_to_totals(t.get_type(), t.get_amount());
+    const Money delta = t.get_signed_amount();
+    if (delta.currency() == balance.currency()) balance += delta;
+    touch();
 }
 
 /**
@@ -52,25 +79,35 @@ void Account::addTransaction(const Transaction& t) {
  * @return true      
  *
  * @details  :
- * 1.    ID
- * 2.  
- * 3.   
+ * 1.    -
+ * 2.      
+ * 3.    (  )
+ *
+ *        
+ *      
  *
  * @note  
- * @complexity O(n)
+ * @complexity O(1)  
  */
-bool Account::removeTransaction(int id) {
+bool Account::removeTransaction(TransactionId id) {
+    std::shared_lock<std::shared_mutex> cut;
+    if (journal_) cut = journal_->apply_guard();
     std::lock_guard<std::mutex> lock(transactions_mutex);
 
-    auto it = std::find_if(transactions.begin(), transactions.end(),
-        [id](const auto& t) { return t.get_id() == id; });
+    load_locked();
+    const std::uint32_t row = index_.find(id);
+    if (row == IdIndex::NONE) return false;
 
-    if (it != transactions.end()) {
-        balance -= it->get_signed_amount();
-        transactions.erase(it);
-        return true;
-    }
-    return false;
+    if (journal_) journal_->log_remove(name, id);
+    auto& list = writable_transactions();
+    add_to_totals(list[row].get_type(), -list[row].get_amount());
+    const Money delta = list[row].get_signed_amount();
+    if (delta.currency() == balance.currency()) balance -= delta;
+    index_.erase(id);
+    tombstones_.push_back(row);
+    if (tombstones_.size() * 2 > list.size()) live_locked();
+    touch();
+    return true;
 }
 
 /**
@@ -86,18 +123,67 @@ bool Account::removeTransaction(int id) {
  * @post  other  ,  
  */
 void Account::move_transactions_from(Account&& other) {
+    other.load_locked();
+    loader_ = nullptr;
     balance = other.balance;
     transactions = std::move(other.transactions);
+    index_ = std::move(other.index_);
+    tombstones_ = std::move(other.tombstones_);
+    by_date_ = std::move(other.by_date_);
+    totals_ = std::move(other.totals_);
+    other.transactions = std::make_shared<TransactionStore>();
+    other.index_.clear();
+    other.tombstones_.clear();
+    other.totals_.clear();
+    other.by_date_.reset();
+    other.balance = Money(0, other.balance.currency());
+    touch();
+    other.touch();
+}
+
+/**
+ * @brief      
+ * @param loaded   (   )
+ *
+ * @details :
+ * 1.  -   ID,  ID - 
+ * 2.       
+ * 3.    ,  -  
+ *
+ * @throws std::invalid_argument   loaded   ID
+ * @complexity O(n)
+ */
+void Account::assign_transactions(TransactionStore&& loaded) {
+    IdIndex index;
+    if (index.assign(loaded.ids()) != IdIndex::NONE) {
+        throw std::invalid_argument("Transaction ID already exists");
+    }
+
+    auto store = std::make_shared<TransactionStore>(std::move(loaded));
+    auto totals = without_empty(sum_by_currency(*store));
+
+    std::lock_guard<std::mutex> lock(transactions_mutex);
+    loader_ = nullptr;
+    totals_ = std::move(totals);
+    transactions = std::move(store);
+    index_ = std::move(index);
+    tombstones_.clear();
+    by_date_.reset();
+    balance = Money(0, balance.currency());
+    for (const auto t : *transactions) {
+        const Money delta = t.get_signed_amount();
+        if (delta.currency() == balance.currency()) balance += delta;
+    }
+    touch();
 }
 
 /**
  * @brief   
  * @param converter  
  *
- * @details :
- * 1.   
- * 2.       
- * 3.    
+ * @details      (,  ):
+ *    ,   .
+ *   ,    
  *
  * @note  :
  * -  
@@ -106,13 +192,7 @@ void Account::move_transactions_from(Account&& other) {
  */
 void Account::recalculateBalance(const CurrencyConverter& converter) {
     std::lock_guard<std::mutex> lock(transactions_mutex);
-    double new_balance = 0.0;
-
-    for (const auto& t : transactions) {
-        new_balance += t.get_amount_in_rub(converter);
-    }
-
-    balance = new_balance;
+    balance = balance_of(totals_, converter, "RUB");
 }
 
 /**
@@ -120,18 +200,24 @@ void Account::recalculateBalance(const CurrencyConverter& converter) {
  * @param converter    
  * @return true     
  *
- * @details  : 0.01 ( )
+ * @details       
+ *    ;     
+ * ,    recalculateBalance,    
  * @note    
  */
 bool Account::validate(const CurrencyConverter& converter) const {
     std::lock_guard<std::mutex> lock(transactions_mutex);
-    double calculated = 0.0;
-
-    for (const auto& t : transactions) {
-        calculated += t.get_amount_in_rub(converter);
+    const auto scanned = sum_by_currency(live_locked());
+    size_t matched = 0;
+    for (const auto& entry : scanned) {
+        if (entry.income.is_zero() && entry.expenses.is_zero()) continue;
+        ++matched;
+        const auto it = std::find_if(totals_.begin(), totals_.end(),
+            [&](const CurrencyTotals& kept) { return kept.currency == entry.currency; });
+        if (it == totals_.end() || it->income != entry.income || it->expenses != entry.expenses) return false;
     }
-
-    return std::abs(calculated - balance) < 0.01;
+    if (matched != totals_.size()) return false;
+    return balance_of(totals_, converter, "RUB") == balance;
 }
 
 /**
@@ -140,22 +226,58 @@ bool Account::validate(const CurrencyConverter& converter) const {
  * @param currency   ( ISO 4217)
  * @return     
  *
- * @details       
+ * @details     , O()
  * @throws std::runtime_error   
  */
-double Account::get_balance_in_currency(const CurrencyConverter& converter,
+Money Account::get_balance_in_currency(const CurrencyConverter& converter,
     const std::string& currency) const {
     std::lock_guard<std::mutex> lock(transactions_mutex);
-    double balance = 0.0;
+    return balance_of(totals_, converter, currency);
+}
 
-    for (const auto& t : transactions) {
-        balance += converter.convert(
-            t.get_signed_amount(),
-            t.get_currency(),
-            currency
-        );
+/**
+ * @brief      
+ *
+ * @details    :  -   
+ *  ,  
+ */
+void Account::add_to_totals(Transaction::Type type, Money amount) {
+    const Symbol code = amount.currency();
+    auto it = std::find_if(totals_.begin(), totals_.end(),
+        [code](const CurrencyTotals& entry) { return entry.income.currency() == code; });
+    if (it == totals_.end()) {
+        totals_.push_back({ std::string(code.view()), Money(0, code), Money(0, code) });
+        it = totals_.end() - 1;
+    }
+    (type == Transaction::Type::INCOME ? it->income : it->expenses) += amount;
+    if (it->income.is_zero() && it->expenses.is_zero()) totals_.erase(it);
+}
+
+/**
+ * @brief    
+ */
+void Account::add_to_totals(const std::vector<CurrencyTotals>& other) {
+    for (const auto& entry : other) {
+        add_to_totals(Transaction::Type::INCOME, entry.income);
+        add_to_totals(Transaction::Type::EXPENSE, entry.expenses);
     }
-    return balance;
+}
+
+/**
+ * @brief    
+ * @param totals      
+ * @param converter  
+ * @param currency  
+ *
+ * @details       ;
+ *       
+ */
+Money Account::balance_of(const std::vector<CurrencyTotals>& totals,
+    const CurrencyConverter& converter, std::string_view currency) {
+    std::vector<Money> nets;
+    nets.reserve(totals.size());
+    for (const auto& entry : totals) nets.push_back(entry.net());
+    return converter.convert_sum(nets, Symbol(currency));
 }
 
 /**
@@ -164,21 +286,245 @@ double Account::get_balance_in_currency(const CurrencyConverter& converter,
  * @param converter  
  *
  * @details :
- * 1.     
- * 2.    other
- * 3.   
+ * 1.     ( )
+ * 2.     
+ * 3.    other
+ * 4.         
+ *       
  *
  * @note   other  ,  
- * @complexity O(n+m)  n  m -  
+ * @complexity O(n+m)  n  m -   ( );
+ *  - O()
  */
 void Account::merge_account(Account&& other, const CurrencyConverter& converter) {
+    std::shared_lock<std::shared_mutex> cut;
+    if (journal_) cut = journal_->apply_guard();
     std::lock_guard<std::mutex> lock(transactions_mutex);
     std::lock_guard<std::mutex> other_lock(other.transactions_mutex);
 
-    transactions.reserve(transactions.size() + other.transactions.size());
-    transactions.insert(transactions.end(),
-        std::make_move_iterator(other.transactions.begin()),
-        std::make_move_iterator(other.transactions.end()));
+    if (journal_) journal_->log_merge(other.name, name);
+    other.live_locked();
+    live_locked();
+
+    //       -    
+    auto& list = writable_transactions();
+    const size_t first = list.size();
+    if (other.transactions.use_count() == 1) list.append(std::move(*other.transactions));
+    else list.append(*other.transactions);
+    index_.reserve(list.size());
+    for (size_t row = first; row < list.size(); ++row) {
+        index_.insert(list.ids()[row], static_cast<std::uint32_t>(row));
+    }
+    by_date_.reset();
+    other.transactions = std::make_shared<TransactionStore>();
+    other.index_.clear();
+    other.by_date_.reset();
+    add_to_totals(other.totals_);
+    other.totals_.clear();
+    other.balance = Money(0, other.balance.currency());
+    touch();
+    other.touch();
+
+    // recalculateBalance()  :   
+    balance = balance_of(totals_, converter, "RUB");
+}
 
-    recalculateBalance(converter);
-}
\ No newline at end of file
+/**
+ * @brief    
+ * @return     
+ *
+ * @details  -   shared_ptr  .
+ *     (SnapshotCompactor)
+ */
+std::shared_ptr<const TransactionStore> Account::snapshot() const {
+    std::lock_guard<std::mutex> lock(transactions_mutex);
+    live_locked();
+    return transactions;
+}
+
+/**
+ * @brief      
+ */
+TransactionSelection Account::transactions_between(const Date& from, const Date& to) const {
+    std::lock_guard<std::mutex> lock(transactions_mutex);
+    const auto& list = live_locked();
+    by_date_.ensure(list.dates());
+    return TransactionSelection(transactions, by_date_.range(from, to, list.dates()));
+}
+
+/**
+ * @brief     
+ */
+TransactionSelection Account::history_page(size_t offset, size_t limit) const {
+    std::lock_guard<std::mutex> lock(transactions_mutex);
+    const auto& list = live_locked();
+    by_date_.ensure(list.dates());
+    const auto& ordered = by_date_.ordered(list.dates());
+    const size_t first = std::min(offset, ordered.size());
+    const size_t last = first + std::min(limit, ordered.size() - first);
+    return TransactionSelection(transactions,
+        std::vector<std::uint32_t>(ordered.begin() + first, ordered.begin() + last));
+}
+
+/**
+ * @brief    
+ * @return    nullptr,   
+ */
+std::shared_ptr<const TransactionStore> Account::loaded_snapshot() const {
+    std::lock_guard<std::mutex> lock(transactions_mutex);
+    if (loader_) return nullptr;
+    live_locked();
+    return transactions;
+}
+
+/**
+ * @brief   ,   
+ */
+const TransactionStore& Account::get_transactions() const {
+    std::lock_guard<std::mutex> lock(transactions_mutex);
+    return live_locked();
+}
+
+/**
+ * @brief   (   -  )
+ */
+size_t Account::transaction_count() const {
+    std::lock_guard<std::mutex> lock(transactions_mutex);
+    return loader_ ? lazy_count_ : transactions->size() - tombstones_.size();
+}
+
+Money Account::get_balance() const {
+    std::lock_guard<std::mutex> lock(transactions_mutex);
+    return balance;
+}
+
+/**
+ * @brief      
+ * @return    ,  
+ */
+std::vector<CurrencyTotals> Account::totals_by_currency() const {
+    std::lock_guard<std::mutex> lock(transactions_mutex);
+    return totals_;
+}
+
+/**
+ * @brief   
+ * @param count    
+ * @param totals     
+ * @param loader  
+ *
+ * @post    -   recalculateBalance
+ */
+void Account::assign_lazy(size_t count, std::vector<CurrencyTotals> totals,
+    std::function<TransactionStore()> loader) {
+    std::lock_guard<std::mutex> lock(transactions_mutex);
+    transactions = std::make_shared<TransactionStore>();
+    index_.clear();
+    tombstones_.clear();
+    by_date_.reset();
+    lazy_count_ = count;
+    totals_ = without_empty(std::move(totals));
+    loader_ = std::move(loader);
+    balance = Money(0, balance.currency());
+}
+
+/**
+ * @brief    
+ */
+void Account::materialize() const {
+    std::lock_guard<std::mutex> lock(transactions_mutex);
+    load_locked();
+}
+
+/**
+ * @brief ,   
+ */
+bool Account::is_materialized() const {
+    std::lock_guard<std::mutex> lock(transactions_mutex);
+    return !loader_;
+}
+
+/**
+ * @brief     
+ *
+ * @details    ,   
+ *     .     
+ *  :     
+ */
+void Account::load_locked() const {
+    if (!loader_) return;
+    auto loaded = std::make_shared<TransactionStore>(loader_());
+    IdIndex index;
+    index.assign(loaded->ids());
+    transactions = std::move(loaded);
+    index_ = std::move(index);
+    by_date_.reset();
+    loader_ = nullptr;
+}
+
+/**
+ * @brief  ,  removeTransaction
+ *
+ * @details      ,  
+ *  :    ,    
+ * writable_transactions.     , 
+ *       ID
+ */
+const TransactionStore& Account::live_locked() const {
+    load_locked();
+    if (!tombstones_.empty()) {
+        std::sort(tombstones_.begin(), tombstones_.end());
+        size_t next = 0;
+        transactions->remove_if([&](const TransactionStore::Row& row) {
+            if (next < tombstones_.size() && tombstones_[next] == row.index()) {
+                ++next;
+                return true;
+            }
+            return false;
+            });
+        by_date_.compact(tombstones_);
+        tombstones_.clear();
+        index_.assign(transactions->ids());
+    }
+    return *transactions;
+}
+
+/**
+ * @brief     
+ */
+std::uint64_t Account::generation() const {
+    std::lock_guard<std::mutex> lock(transactions_mutex);
+    return generation_;
+}
+
+/**
+ * @brief    
+ * @param generation   
+ *
+ * @details     generation,  
+ *     ,     
+ */
+void Account::restore_generation(std::uint64_t generation) {
+    std::lock_guard<std::mutex> lock(transactions_mutex);
+    generation_ = generation;
+    std::uint64_t clock = generation_clock_.load(std::memory_order_relaxed);
+    while (clock <= generation &&
+        !generation_clock_.compare_exchange_weak(clock, generation + 1, std::memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief   ,   
+ * @return   ,      
+ *
+ * @details     ,    
+ *   .     
+ * @complexity O(1)  , O(n)     
+ */
+TransactionStore& Account::writable_transactions() {
+    load_locked();
+    if (transactions.use_count() > 1) {
+        transactions = std::make_shared<TransactionStore>(*transactions);
+    }
+    return *transactions;
+}
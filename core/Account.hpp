@@ -14,10 +14,27 @@
  * 2.     
  * 3.     
  * 4.   
+ *
+ * @section account_balance 
+ *     (Money)    : 
+ *     ,   
+ *     .    ( 
+ * )        ,  validate()
+ *    
+ *
+ *     : ,  
+ *      .  -  
+ *  ,       O(),
+ *   O()
  */
 
 #pragma once
 #include "Time_Manager.hpp"
+#include "DateIndex.hpp"
+#include "IdIndex.hpp"
+#include "TransactionQuery.hpp"
+#include "TransactionStore.hpp"
+#include "storage/LedgerData.hpp"
 #include <iostream>
 #include <string>
 #include <stdexcept>
@@ -25,8 +42,14 @@
 #include <sstream>
 #include <ctime>
 #include <vector>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <mutex>
 
+class Journal;
+
  /**
   * @class Account
   * @brief     
@@ -39,9 +62,19 @@
 class Account {
 private:
     std::string name;       ///<   ()
-    double balance;         ///<   (  )
-    std::vector<Transaction> transactions;  ///<  
+    Money balance;          ///<   ( )
+    mutable std::shared_ptr<TransactionStore> transactions; ///<    (  )
+    mutable IdIndex index_;                 ///< ID ->    transactions (  )
+    mutable std::vector<std::uint32_t> tombstones_; ///< ,     
+    mutable DateIndex by_date_;             ///<  transactions    (   )
     mutable std::mutex transactions_mutex;  ///<   
+    mutable std::function<TransactionStore()> loader_; ///<    (,  )
+    size_t lazy_count_ = 0;                 ///<     (  )
+    std::vector<CurrencyTotals> totals_;    ///<      (  -  )
+    Journal* journal_ = nullptr;            ///<   ( )
+    std::uint64_t generation_ = 0;          ///<    (. generation())
+
+    static inline std::atomic<std::uint64_t> generation_clock_{ 1 }; ///<   
 
     //  
     Account(const Account&) = delete;
@@ -64,14 +97,16 @@ public:
      * @brief   
      * @details     " "   
      */
-    Account() : name(" "), balance(0) {}
+    Account() : name(" "), balance(0, Symbol("RUB")),
+        transactions(std::make_shared<TransactionStore>()) {}
 
     /**
      * @brief  
      * @param accountName  
      * @throws std::invalid_argument   
      */
-    explicit Account(const std::string& accountName) : name(accountName), balance(0) {
+    explicit Account(const std::string& accountName) : name(accountName), balance(0, Symbol("RUB")),
+        transactions(std::make_shared<TransactionStore>()) {
         if (accountName.empty()) {
             throw std::invalid_argument("     ");
         }
@@ -86,7 +121,9 @@ public:
      * -  
      * -  ID 
      *
-     * @post   
+     * @post      ;   
+     *  -   recalculateBalance
+     * @post   ,    
      * @note  
      */
     void addTransaction(const Transaction& t);
@@ -96,10 +133,12 @@ public:
      * @param id   
      * @return true      
      *
-     * @post   
-     * @note : O(n)
+     * @post      ;   
+     *  -   recalculateBalance
+     * @post   ,    
+     * @note : O(1)   -    
      */
-    bool removeTransaction(int id);
+    bool removeTransaction(TransactionId id);
 
     /**
      * @brief     
@@ -109,6 +148,58 @@ public:
      * @note   -       
      */
     void move_transactions_from(Account&& other);
+
+    /**
+     * @brief     
+     * @param loaded ,   
+     * @throws std::invalid_argument   ID 
+     *
+     * @details   addTransaction  :
+     *  ID    - ID,
+     *    
+     *
+     * @post       ,
+     *    recalculateBalance
+     * @note : O(n)
+     */
+    void assign_transactions(TransactionStore&& loaded);
+
+    /**
+     * @brief   :     
+     * @param count    
+     * @param totals     
+     * @param loader     
+     *
+     * @details    ,  (recalculateBalance)
+     *       .  ,  
+     *   (get_transactions, addTransaction, snapshot, ...),
+     *   loader
+     *
+     * @throws  loader    ,
+     *   
+     */
+    void assign_lazy(size_t count, std::vector<CurrencyTotals> totals,
+        std::function<TransactionStore()> loader);
+
+    /**
+     * @brief    
+     * @note      
+     */
+    void materialize() const;
+
+    /**
+     * @brief ,   
+     */
+    bool is_materialized() const;
+
+    /**
+     * @brief   
+     * @param journal   nullptr,   
+     *
+     * @details     (,  ),
+     *     
+     */
+    void attach_journal(Journal* journal) { journal_ = journal; }
     /// @}
 
     /// @name   
@@ -117,11 +208,11 @@ public:
      * @brief   
      * @param converter    
      *
-     * @details     :
-     * -  (/)
-     * -  (  )
+     * @details       ,
+     *        
      *
-     * @note    
+     * @note       
+     * @complexity O( )
      */
     void recalculateBalance(const CurrencyConverter& converter);
 
@@ -130,7 +221,10 @@ public:
      * @param converter    
      * @return true     
      *
-     * @note  : 0.01 ( )
+     * @details       
+     *     ,   
+     *    
+     * @note  :  ,   
      */
     bool validate(const CurrencyConverter& converter) const;
 
@@ -140,9 +234,10 @@ public:
      * @param currency  
      * @return     
      *
-     * @note      
+     * @note      
+     * @complexity O( )
      */
-    double get_balance_in_currency(const CurrencyConverter& converter,
+    Money get_balance_in_currency(const CurrencyConverter& converter,
         const std::string& currency) const;
     /// @}
 
@@ -156,15 +251,99 @@ public:
 
     /**
      * @brief   
-     * @return    
+     * @return   
+     * @note :     
      */
-    double get_balance() const { return balance; }
+    Money get_balance() const;
 
     /**
      * @brief   
-     * @return     
+     * @return     
+     * @note   
+     */
+    const TransactionStore& get_transactions() const;
+
+    /**
+     * @brief      
+     */
+    size_t transaction_count() const;
+
+    /**
+     * @brief      
+     * @return    ,    
+     *
+     * @details   :     
+     *  ,      
+     */
+    std::vector<CurrencyTotals> totals_by_currency() const;
+
+    /**
+     * @brief  ,     
+     * @return  snapshot(),  nullptr   
+     *
+     * @note       , 
+     *      
+     */
+    std::shared_ptr<const TransactionStore> loaded_snapshot() const;
+
+    /**
+     * @brief    
+     * @return     
+     *
+     * @details    :    
+     *  ,    .   
+     *     (copy-on-write),  
+     *  ,     
+     *
+     * @note ,       
      */
-    const std::vector<Transaction>& get_transactions() const { return transactions; }
+    std::shared_ptr<const TransactionStore> snapshot() const;
+
+    /**
+     * @brief      
+     * @param from   ()
+     * @param to   ()
+     * @return    
+     *
+     * @details    :   
+     *  O(k)   ,     
+     * @note : O(log n + k);    
+     */
+    TransactionSelection transactions_between(const Date& from, const Date& to) const;
+
+    /**
+     * @brief     
+     * @param offset   ( )  
+     * @param limit   
+     * @return    
+     *
+     * @details       : 
+     * ,       ,  
+     *   
+     * @note : O(limit)
+     */
+    TransactionSelection history_page(size_t offset, size_t limit) const;
+
+    /**
+     * @brief   
+     * @return   
+     *
+     * @details   (addTransaction, removeTransaction, set_name,
+     * merge_account, )      
+     *  .     , 
+     *     ,    
+     *    -       
+     */
+    std::uint64_t generation() const;
+
+    /**
+     * @brief  ,     
+     * @param generation    
+     *
+     * @post     generation
+     * @note     assign_transactions
+     */
+    void restore_generation(std::uint64_t generation);
     /// @}
 
     /// @name 
@@ -176,7 +355,10 @@ public:
      */
     void set_name(const std::string& newName) {
         if (newName.empty()) throw std::invalid_argument("     ");
+        std::lock_guard<std::mutex> lock(transactions_mutex);
+        load_locked(); //       
         name = newName;
+        touch();
     }
     /// @}
 
@@ -187,6 +369,70 @@ public:
      *
      * @details     other   
      * @post   other  
+     * @post   ,    
      */
     void merge_account(Account&& other, const CurrencyConverter& converter);
+
+private:
+    /**
+     * @brief     
+     * @pre   transactions_mutex
+     */
+    void touch() { generation_ = generation_clock_.fetch_add(1, std::memory_order_relaxed); }
+
+    /**
+     * @brief   
+     * @pre   transactions_mutex
+     */
+    void load_locked() const;
+
+    /**
+     * @brief      
+     * @return    
+     *
+     * @details  (removeTransaction)   ; 
+     *     ,   
+     *   .    O(1)   
+     *   O(n)   
+     * @pre   transactions_mutex
+     */
+    const TransactionStore& live_locked() const;
+
+    /**
+     * @brief      
+     * @param type  
+     * @param amount  ( -  )
+     *
+     * @details ,      ,  ,
+     *   
+     * @pre   transactions_mutex
+     */
+    void add_to_totals(Transaction::Type type, Money amount);
+
+    /**
+     * @brief    
+     * @param other   
+     * @pre   transactions_mutex
+     */
+    void add_to_totals(const std::vector<CurrencyTotals>& other);
+
+    /**
+     * @brief    
+     * @param totals   
+     * @param converter  
+     * @param currency  
+     * @return      
+     */
+    static Money balance_of(const std::vector<CurrencyTotals>& totals,
+        const CurrencyConverter& converter, std::string_view currency);
+
+    /**
+     * @brief     
+     * @return ,    
+     *
+     * @details   .   
+     *   (snapshot()),  
+     * @pre   transactions_mutex
+     */
+    TransactionStore& writable_transactions();
 };
\ No newline at end of file
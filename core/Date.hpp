@@ -9,6 +9,12 @@
  * -    
  * -   
  *
+ *    32-  -    1970-01-01.
+ * ,        
+ * ,   ///   O(1).
+ *   //   - constexpr ( civil
+ * . ,    ).
+ *
  * @section date_rules    
  * 1.      (  )
  * 2.   2000-2100 .
@@ -18,10 +24,11 @@
 
 
 #pragma once
+#include <cstdint>
 #include <iostream>
+#include <iomanip>
 #include <string>
 #include <stdexcept>
-#include <iomanip>
 #include <sstream>
 #include <ctime>
 
@@ -35,97 +42,92 @@
  * 3.      /
  */
 class Date {
-private:
-	int year;   ///<  (2000-2100)
-	int month;  ///<  (1-12)
-	int day;    ///<  (1-31    )
-
 public:
+	/**
+	 * @struct YearMonthDay
+	 * @brief    //
+	 */
+	struct YearMonthDay {
+		int year;   ///< 
+		int month;  ///<  (1-12)
+		int day;    ///<  (1-31)
+	};
+
+	static constexpr int MIN_YEAR = 2000; ///<   
+	static constexpr int MAX_YEAR = 2100; ///<   
+	static constexpr size_t ISO_SIZE = 10; ///<   YYYY-MM-DD
 
+	/// @name  
+	/// @{
 	/**
 	 * @brief   
+	 * @param y 
 	 * @return true   
 	 *
 	 * @note :
 	 * -    4,    100 
 	 * -    400
 	 */
-	bool is_leap_year() const
+	static constexpr bool is_leap_year(int y)
 	{
-		return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+		return (y % 4 == 0 && y % 100 != 0) || (y % 400 == 0);
 	}
 
 	/**
-	 * @brief      
+	 * @brief    
+	 * @param y 
+	 * @param m  (1-12)
 	 * @return   (28-31)
-	 *
-	 * @note      
 	 */
-	int day_in_month() const
+	static constexpr int days_in_month(int y, int m)
 	{
-		const int days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
-		if (month == 2 && is_leap_year())
-			return 29;
-		return days[month - 1];
+		if (m == 2) return is_leap_year(y) ? 29 : 28;
+		return (m == 4 || m == 6 || m == 9 || m == 11) ? 30 : 31;
 	}
 
 	/**
 	 * @brief   
-	 * @return true   
-	 *
-	 * @details :
-	 * -    
-	 * -  
-	 * -     /
+	 * @return true    ,  1-12     
 	 */
-	bool is_valid() const {
-		if (year < 2000 || year > 2100) return false;
-		if (month < 1 || month > 12) return false;
-
-		const int days_in_month[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
-		int max_days = days_in_month[month - 1];
-
-		//     
-		if (month == 2 && is_leap_year()) {
-			max_days = 29;
-		}
-
-		return (day >= 1 && day <= max_days);
+	static constexpr bool is_valid(int y, int m, int d)
+	{
+		return y >= MIN_YEAR && y <= MAX_YEAR && m >= 1 && m <= 12
+			&& d >= 1 && d <= days_in_month(y, m);
 	}
 
 	/**
-	 * @brief      YYYY-MM-DD
-	 * @return  
-	 *
-	 * @example
-	 * Date(2023, 5, 20).to_string() => "2023-05-20"
+	 * @brief    1970-01-01
+	 * @param y 
+	 * @param m  (1-12)
+	 * @param d 
 	 */
-	std::string to_string() const {
-		std::ostringstream oss;
-		oss << std::setw(4) << std::setfill('0') << year << "-"
-			<< std::setw(2) << std::setfill('0') << month << "-"
-			<< std::setw(2) << std::setfill('0') << day;
-		return oss.str();
+	static constexpr std::int32_t days_from_civil(int y, int m, int d)
+	{
+		y -= m <= 2;
+		const int era = (y >= 0 ? y : y - 399) / 400;
+		const int yoe = y - era * 400;
+		const int doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+		const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+		return era * 146097 + doe - 719468;
 	}
 
 	/**
-	 * @brief  Date    YYYY-MM-DD
-	 * @param date_str   
-	 * @return  Date
-	 *
-	 * @throws std::invalid_argument   
-	 *
-	 * @example
-	 * Date::from_string("2023-05-20") => Date(2023, 5, 20)
+	 * @brief //     1970-01-01
+	 * @param days  
 	 */
-	static Date from_string(const std::string& date_str) {
-		// : "YYYY-MM-DD"
-		int y, m, d;
-		char dash;
-		std::istringstream iss(date_str);
-		iss >> y >> dash >> m >> dash >> d;
-		return Date(y, m, d);
+	static constexpr YearMonthDay civil_from_days(std::int32_t days)
+	{
+		days += 719468;
+		const int era = (days >= 0 ? days : days - 146096) / 146097;
+		const int doe = days - era * 146097;
+		const int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+		const int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+		const int mp = (5 * doy + 2) / 153;
+		const int d = doy - (153 * mp + 2) / 5 + 1;
+		const int m = mp < 10 ? mp + 3 : mp - 9;
+		return { yoe + era * 400 + (m <= 2), m, d };
 	}
+	/// @}
 
 	/**
 	 * @brief    
@@ -135,9 +137,9 @@ public:
 	 *
 	 * @throws std::invalid_argument   
 	 */
-	Date(int y, int m, int d) : year(y), month(m), day(d)
+	constexpr Date(int y, int m, int d) : days_(days_from_civil(y, m, d))
 	{
-		if (!is_valid()) throw std::invalid_argument("Invalid date");
+		if (!is_valid(y, m, d)) throw std::invalid_argument("Invalid date");
 	}
 
 	/**
@@ -149,25 +151,122 @@ public:
 	Date() {
 		std::time_t time = std::time(nullptr);
 
+		std::tm now;
 		//  Windows
 #ifdef _WIN32
-		std::tm now;
 		localtime_s(&now, &time);
 		//  Linux/macOS
 #else
-		std::tm* now = std::localtime(&time);
+		localtime_r(&time, &now);
 #endif
 
-		year = now.tm_year + 1900;
-		month = now.tm_mon + 1;
-		day = now.tm_mday;
+		days_ = days_from_civil(now.tm_year + 1900, now.tm_mon + 1, now.tm_mday);
+	}
+
+	/**
+	 * @brief       1970-01-01
+	 * @param days   (day_number()  )
+	 * @throws std::invalid_argument    2000-2100 .
+	 */
+	static constexpr Date from_day_number(std::int32_t days)
+	{
+		const YearMonthDay ymd = civil_from_days(days);
+		return Date(ymd.year, ymd.month, ymd.day);
+	}
+
+	/**
+	 * @brief    
+	 * @return true   
+	 */
+	constexpr bool is_leap_year() const { return is_leap_year(get_year()); }
+
+	/**
+	 * @brief      
+	 * @return   (28-31)
+	 *
+	 * @note      
+	 */
+	constexpr int day_in_month() const
+	{
+		const YearMonthDay ymd = civil();
+		return days_in_month(ymd.year, ymd.month);
+	}
+
+	/**
+	 * @brief   
+	 * @return true     2000-2100 .
+	 */
+	constexpr bool is_valid() const {
+		return days_ >= days_from_civil(MIN_YEAR, 1, 1) && days_ <= days_from_civil(MAX_YEAR, 12, 31);
+	}
+
+	/**
+	 * @brief     YYYY-MM-DD   
+	 * @param out    ISO_SIZE  (   )
+	 * @return     
+	 */
+	constexpr char* format_iso(char* out) const {
+		const YearMonthDay ymd = civil();
+		const auto put2 = [](char* p, int v) {
+			p[0] = static_cast<char>('0' + v / 10);
+			p[1] = static_cast<char>('0' + v % 10);
+		};
+		put2(out, ymd.year / 100);
+		put2(out + 2, ymd.year % 100);
+		out[4] = '-';
+		put2(out + 5, ymd.month);
+		out[7] = '-';
+		put2(out + 8, ymd.day);
+		return out + ISO_SIZE;
+	}
+
+	/**
+	 * @brief      YYYY-MM-DD
+	 * @return  
+	 *
+	 * @example
+	 * Date(2023, 5, 20).to_string() => "2023-05-20"
+	 */
+	std::string to_string() const {
+		char buf[ISO_SIZE];
+		return std::string(buf, format_iso(buf));
+	}
+
+	/**
+	 * @brief  Date    YYYY-MM-DD
+	 * @param date_str   
+	 * @return  Date
+	 *
+	 * @throws std::invalid_argument   
+	 *
+	 * @example
+	 * Date::from_string("2023-05-20") => Date(2023, 5, 20)
+	 */
+	static Date from_string(const std::string& date_str) {
+		// : "YYYY-MM-DD"
+		int y, m, d;
+		char dash;
+		std::istringstream iss(date_str);
+		iss >> y >> dash >> m >> dash >> d;
+		return Date(y, m, d);
 	}
 
 	/// @name 
 	/// @{
-	int get_year() const { return year; }   ///<  
-	int get_month() const { return month; } ///<  
-	int get_day() const { return day; }     ///<  
+	constexpr YearMonthDay civil() const { return civil_from_days(days_); } ///< ,      
+	constexpr int get_year() const { return civil().year; }   ///<  
+	constexpr int get_month() const { return civil().month; } ///<  
+	constexpr int get_day() const { return civil().day; }     ///<  
+	/// @}
+
+	/// @name  
+	/// @details     ;   - 
+	/// @{
+	constexpr std::int32_t day_number() const { return days_; } ///<    1970-01-01
+	constexpr int weekday() const { return (days_ + 3) % 7; }  ///<  : 0 - 
+	constexpr std::int32_t week_key() const { return (days_ + 3) / 7; } ///<   ( )
+	constexpr int month_key() const { const YearMonthDay ymd = civil(); return ymd.year * 12 + ymd.month - 1; } ///<  * 12 +  - 1
+	constexpr int quarter_key() const { return month_key() / 3; } ///<  * 4 +  - 1
 	/// @}
 
 	/// @name 
@@ -178,12 +277,9 @@ public:
 	 * @throws std::invalid_argument   
 	 */
 	void seet_year(int y) {
-		int temp = year;
-		year = y;
-		if (!is_valid()) {
-			year = temp;
-			throw std::invalid_argument("Invalid year");
-		}
+		const YearMonthDay ymd = civil();
+		if (!is_valid(y, ymd.month, ymd.day)) throw std::invalid_argument("Invalid year");
+		days_ = days_from_civil(y, ymd.month, ymd.day);
 	}
 
 	/**
@@ -192,12 +288,9 @@ public:
 	 * @throws std::invalid_argument   
 	 */
 	void seet_month(int m) {
-		int temp = month;
-		month = m;
-		if (!is_valid()) {
-			month = temp;
-			throw std::invalid_argument("Invalid month");
-		}
+		const YearMonthDay ymd = civil();
+		if (!is_valid(ymd.year, m, ymd.day)) throw std::invalid_argument("Invalid month");
+		days_ = days_from_civil(ymd.year, m, ymd.day);
 	}
 
 	/**
@@ -206,38 +299,20 @@ public:
 	 * @throws std::invalid_argument   
 	 */
 	void seet_day(int d) {
-		int temp = day;
-		day = d;
-		if (!is_valid()) {
-			day = temp;
-			throw std::invalid_argument("Invalid day");
-		}
+		const YearMonthDay ymd = civil();
+		if (!is_valid(ymd.year, ymd.month, d)) throw std::invalid_argument("Invalid day");
+		days_ = days_from_civil(ymd.year, ymd.month, d);
 	}
 	/// @}
 
 	/// @name  
 	/// @{
-	/**
-	 * @brief  ""
-	 * @param other   
-	 * @return true    
-	 */
-	bool operator<(const Date& other) const
-	{
-		return (year < other.year) ||
-			(year == other.year && month < other.month) ||
-			(year == other.year && month == other.month && day < other.day);
-	}
-
-	/**
-	 * @brief  
-	 * @param other   
-	 * @return true   
-	 */
-	bool operator==(const Date& other) const
-	{
-		return year == other.year && month == other.month && month == other.month;
-	}
+	constexpr bool operator<(const Date& other) const { return days_ < other.days_; }   ///<   
+	constexpr bool operator>(const Date& other) const { return days_ > other.days_; }   ///<   
+	constexpr bool operator<=(const Date& other) const { return days_ <= other.days_; } ///<  
+	constexpr bool operator>=(const Date& other) const { return days_ >= other.days_; } ///<  
+	constexpr bool operator==(const Date& other) const { return days_ == other.days_; } ///<  
+	constexpr bool operator!=(const Date& other) const { return days_ != other.days_; } ///<  
 	/// @}
 
 	/// @name  /
@@ -252,7 +327,8 @@ public:
 	 */
 	friend std::ostream& operator<<(std::ostream& os, const Date& d)
 	{
-		os << d.year << " " << d.month << " " << d.day;
+		const YearMonthDay ymd = d.civil();
+		os << ymd.year << " " << ymd.month << " " << ymd.day;
 		return os;
 	}
 
@@ -265,12 +341,24 @@ public:
 	 */
 	friend std::istream& operator>>(std::istream& is, Date& d)
 	{
-		is >> d.year >> d.month >> d.day;
-		if (!d.is_valid())
+		int y = 0, m = 0, day = 0;
+		is >> y >> m >> day;
+		if (is && is_valid(y, m, day))
+		{
+			d.days_ = days_from_civil(y, m, day);
+		}
+		else
 		{
 			is.setstate(std::ios::failbit);
 		}
 		return is;
 	}
+	/// @}
+
+private:
+	std::int32_t days_; ///<    1970-01-01
 };
-/// @}
+
+static_assert(sizeof(Date) == 4, "Date   4 ");
+static_assert(Date(2000, 3, 1).day_number() - Date(2000, 2, 28).day_number() == 2, "2000 -  ");
+static_assert(Date::civil_from_days(Date(2100, 12, 31).day_number()).day == 31, "civil_from_days  days_from_civil");
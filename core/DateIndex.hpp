@@ -0,0 +1,166 @@
+/**
+ * @file DateIndex.hpp
+ * @brief      
+ *
+ * @details   TransactionStore    (, 
+ * )    :
+ * -   -   ;
+ * -    - ,     O( ).
+ *
+ *       ,   
+ *    .    -  
+ *     : O(log n + k). 
+ *      -  ,
+ *       .
+ */
+
+#pragma once
+#include "Date.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+ /**
+  * @class DateIndex
+  * @brief   ,   
+  *
+  * @details    :    
+  *  (TransactionStore::dates()).    
+  *  (ensure),       ,   
+  *
+  * @note  :   Account
+  */
+class DateIndex {
+public:
+    static constexpr size_t MIN_BUFFER = 64; ///<       
+
+    /**
+     * @brief  ,     
+     * @param dates   
+     * @complexity O(n)  ,    ,  O(n log n)
+     */
+    void ensure(const std::vector<Date>& dates) {
+        if (ready_) return;
+        run_.resize(dates.size());
+        for (size_t row = 0; row < dates.size(); ++row) run_[row] = static_cast<std::uint32_t>(row);
+        if (!std::is_sorted(dates.begin(), dates.end())) {
+            std::sort(run_.begin(), run_.end(), Before{ &dates });
+        }
+        buffer_.clear();
+        ready_ = true;
+    }
+
+    /**
+     * @brief   (     )
+     */
+    void reset() {
+        run_.clear();
+        run_.shrink_to_fit();
+        buffer_.clear();
+        ready_ = false;
+    }
+
+    bool ready() const { return ready_; } ///<   
+
+    /**
+     * @brief   
+     * @param row   (dates    )
+     * @param dates   
+     * @note     
+     */
+    void insert(std::uint32_t row, const std::vector<Date>& dates) {
+        if (!ready_) return;
+        const Before before{ &dates };
+        buffer_.insert(std::upper_bound(buffer_.begin(), buffer_.end(), row, before), row);
+        if (buffer_.size() > MIN_BUFFER && buffer_.size() * buffer_.size() > run_.size()) flush(dates);
+    }
+
+    /**
+     * @brief     
+     * @param dead      ( )
+     *
+     * @details  :    
+     *    ,       
+     */
+    void compact(const std::vector<std::uint32_t>& dead) {
+        if (!ready_ || dead.empty()) return;
+        const auto renumber = [&](std::vector<std::uint32_t>& rows) {
+            size_t kept = 0;
+            for (std::uint32_t row : rows) {
+                auto it = std::lower_bound(dead.begin(), dead.end(), row);
+                if (it != dead.end() && *it == row) continue;
+                rows[kept++] = row - static_cast<std::uint32_t>(it - dead.begin());
+            }
+            rows.resize(kept);
+        };
+        renumber(run_);
+        renumber(buffer_);
+    }
+
+    /**
+     * @brief     [from, to]   
+     * @param dates   
+     * @complexity O(log n + k)
+     */
+    std::vector<std::uint32_t> range(const Date& from, const Date& to, const std::vector<Date>& dates) const {
+        std::vector<std::uint32_t> rows;
+        if (to < from) return rows;
+        const Before before{ &dates };
+        const auto slice = [&](const std::vector<std::uint32_t>& sorted) {
+            auto first = std::partition_point(sorted.begin(), sorted.end(),
+                [&](std::uint32_t row) { return dates[row] < from; });
+            auto last = std::partition_point(first, sorted.end(),
+                [&](std::uint32_t row) { return dates[row] <= to; });
+            return std::make_pair(first, last);
+        };
+        const auto a = slice(run_);
+        const auto b = slice(buffer_);
+        rows.reserve(static_cast<size_t>((a.second - a.first) + (b.second - b.first)));
+        std::merge(a.first, a.second, b.first, b.second, std::back_inserter(rows), before);
+        return rows;
+    }
+
+    /**
+     * @brief     
+     * @param dates   
+     * @return    (   )
+     * @complexity O(1),       
+     */
+    const std::vector<std::uint32_t>& ordered(const std::vector<Date>& dates) {
+        flush(dates);
+        return run_;
+    }
+
+private:
+    /**
+     * @brief    (,  )
+     */
+    struct Before {
+        const std::vector<Date>* dates;
+        bool operator()(std::uint32_t a, std::uint32_t b) const {
+            const Date& da = (*dates)[a];
+            const Date& db = (*dates)[b];
+            return da < db || (da == db && a < b);
+        }
+    };
+
+    /**
+     * @brief     
+     */
+    void flush(const std::vector<Date>& dates) {
+        if (buffer_.empty()) return;
+        std::vector<std::uint32_t> merged;
+        merged.reserve(run_.size() + buffer_.size());
+        std::merge(run_.begin(), run_.end(), buffer_.begin(), buffer_.end(),
+            std::back_inserter(merged), Before{ &dates });
+        run_.swap(merged);
+        buffer_.clear();
+    }
+
+    std::vector<std::uint32_t> run_;    ///<  
+    std::vector<std::uint32_t> buffer_; ///<   ()
+    bool ready_ = false;                ///<  
+};
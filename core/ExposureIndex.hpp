@@ -0,0 +1,121 @@
+/**
+ * @file ExposureIndex.hpp
+ * @brief   " -> ,    "
+ *
+ * @details        
+ * ,    (RateDiff).    
+ *     ,     -
+ *      (Account::generation),  
+ *  .  (sync)     ,
+ *     :   - O(1)  .
+ */
+
+#pragma once
+#include "Account.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+ /**
+  * @class ExposureIndex
+  * @brief      
+  *
+  * @note  : FinanceCore    ,
+  *     (Journal::freeze)
+  */
+class ExposureIndex {
+public:
+    /**
+     * @brief      
+     * @param accounts   
+     * @return  ,     ( )
+     * @complexity O(n log n)    (n - )  O()
+     *    
+     */
+    std::vector<std::string> sync(const std::map<std::string, Account>& accounts) {
+        std::vector<std::string> changed;
+        for (auto it = accounts_.begin(); it != accounts_.end();) {
+            if (accounts.count(it->first) == 0) {
+                unlink(it->first, it->second.currencies);
+                it = accounts_.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        for (const auto& [name, account] : accounts) {
+            const std::uint64_t generation = account.generation();
+            auto [it, inserted] = accounts_.try_emplace(name);
+            if (!inserted && it->second.generation == generation) continue;
+            changed.push_back(name);
+
+            std::vector<Symbol> currencies;
+            for (const auto& totals : account.totals_by_currency()) currencies.push_back(totals.income.currency());
+            std::sort(currencies.begin(), currencies.end());
+            if (inserted || currencies != it->second.currencies) {
+                unlink(name, it->second.currencies);
+                for (Symbol currency : currencies) {
+                    auto& holders = by_currency_[currency];
+                    holders.insert(std::upper_bound(holders.begin(), holders.end(), name), name);
+                }
+                it->second.currencies = std::move(currencies);
+            }
+            it->second.generation = generation;
+        }
+        return changed;
+    }
+
+    /**
+     * @brief    (,    )
+     */
+    void clear() {
+        accounts_.clear();
+        by_currency_.clear();
+    }
+
+    /**
+     * @brief ,        
+     * @param currencies 
+     * @return    ,  
+     */
+    std::vector<std::string> holders(const std::vector<Symbol>& currencies) const {
+        std::vector<std::string> result;
+        for (Symbol currency : currencies) {
+            auto it = by_currency_.find(currency);
+            if (it != by_currency_.end()) result.insert(result.end(), it->second.begin(), it->second.end());
+        }
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+    }
+
+private:
+    /**
+     * @struct Entry
+     * @brief      
+     */
+    struct Entry {
+        std::uint64_t generation = 0;  ///< Account::generation()  
+        std::vector<Symbol> currencies; ///<   ()
+    };
+
+    /**
+     * @brief      
+     */
+    void unlink(const std::string& name, const std::vector<Symbol>& currencies) {
+        for (Symbol currency : currencies) {
+            auto it = by_currency_.find(currency);
+            if (it == by_currency_.end()) continue;
+            auto& holders = it->second;
+            auto pos = std::lower_bound(holders.begin(), holders.end(), name);
+            if (pos != holders.end() && *pos == name) holders.erase(pos);
+            if (holders.empty()) by_currency_.erase(it);
+        }
+    }
+
+    std::map<std::string, Entry> accounts_;                               ///<   ->  
+    std::unordered_map<Symbol, std::vector<std::string>> by_currency_;    ///<  ->   ()
+};
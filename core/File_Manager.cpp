@@ -4,215 +4,447 @@
  *
  * @details    :
  * - /   
- * - / 
- * -   
+ * - /   CSV
+ * -     
  * -   -
  *
- * @section file_format_sec   
- * 1.      [Account:]
- * 2.   CSV-
- * 3. : UTF-8
- * 4.   
+ * @section file_format_sec   
+ * 1. transactions.ledger/ -  :   
+ *      (. SegmentStore)
+ * 2. transactions.journal -     (. Journal)
+ * 3. transactions.snap -     
+ *    (. LedgerSnapshot),    
+ * 4. transactions.dat - CSV   [Account:] (. LedgerCsv),
+ *          ()
+ * 5.  : UTF-8
+ * 6.   
  */
 
 #include "FinanceCore.hpp"
+#include "storage/Journal.hpp"
+#include "storage/LedgerCsv.hpp"
+#include "storage/LedgerSnapshot.hpp"
+#include "storage/MappedFile.hpp"
+#include "storage/MappedLedger.hpp"
+#include "storage/SegmentStore.hpp"
+#include "storage/SnapshotCompactor.hpp"
 #include <fstream>
 #include <filesystem>
 
- /**
-  * @brief    
-  * @param vec    
-  * @param delimiter 
-  * @return  
-  *
-  * @details    :
-  * -      
-  * -    "-"
-  *
-  * @par :
-  * @code
-  * join_strings({"food","transport"}, ',') => "food,transport"
-  * @endcode
-  */
-static std::string join_strings(const std::vector<std::string>& vec, const char delimiter) {
-    std::string result;
-    for (size_t i = 0; i < vec.size(); ++i) {
-        if (i != 0) result += delimiter;
-        result += vec[i];
-    }
-    return result;
-}
-
 /**
- * @brief   
- * @param str  
- * @param prefix  
- * @return true     prefix
- */
-static bool starts_with(const std::string& str, const std::string& prefix) {
-    return str.size() >= prefix.size() &&
-        str.compare(0, prefix.size(), prefix) == 0;
-}
-
-/**
- * @brief      
- *
- * @details  :
- * 1.     ( )
- * 2.   :
- *    -   [Account:]
- *    -     CSV
- * 3.      
- *
- * @throws std::ios_base::failure   
- * @post     
- *
- * @par   :
- * @code
- * id,amount,type,category,yyyy mm dd,currency,description,tags
- * @endcode
+ * @brief        
+ *
+ * @details         ,
+ *     fsync    -
+ *     .   :
+ *      (),
+ *  .      
+ * ,     
+ *
+ * @note    ,    
+ *      
+ *
+ * @see Journal::sync()
+ * @see SegmentStore::write()
  */
 void FinanceCore::saveData() {
-    std::ofstream file(dataFile);
-    if (!file) {
-        std::cerr << ":      !\n";
+    if (!journal_) return;
+    try {
+        journal_->sync();
+    }
+    catch (const std::exception& e) {
+        std::cerr << ":    : " << e.what() << "\n";
         return;
     }
 
-    for (const auto& [name, account] : accounts) {
-        file << "[Account:" << name << "]\n";
-        for (const auto& t : account.get_transactions()) {
-            file << t.get_id() << ","
-                << t.get_amount() << ","
-                << static_cast<int>(t.get_type()) << ","
-                << t.get_category() << ","
-                << t.get_date() << ","
-                << t.get_currency() << ","
-                << t.get_description() << ","
-                << (t.get_tags().empty() ? "-" : join_strings(t.get_tags(), ';')) << "\n";
-        }
+    try {
+        if (compactor_) compactor_->compact();
+    }
+    catch (const std::exception& e) {
+        std::cerr << ":     : " << e.what() << "\n";
+        std::cout << "   : " << std::filesystem::absolute(journalFile) << "\n";
+        return;
     }
-    std::cout << "  : " << std::filesystem::absolute(dataFile) << "\n";
+    std::cout << "  : " << std::filesystem::absolute(ledgerDir) << "\n";
+}
+
+/**
+ * @brief       
+ *
+ * @details   ,   ,
+ *     ,   
+ *   
+ */
+void FinanceCore::showStorageStats() const {
+    if (!journal_ || !compactor_) return;
+    const auto journal = journal_->stats();
+    const auto compaction = compactor_->stats();
+
+    std::cout << "\n===   ===\n"
+        << ": " << journalFile << "\n"
+        << ": " << journal_->size() << " ,  : " << journal_->last_lsn() << "\n"
+        << " : " << journal.records << "  " << journal.batches << " fsync\n"
+        << ": " << compaction.runs
+        << ", : " << compaction.bytes_reclaimed << " "
+        << " (: " << compaction.last_bytes_reclaimed << ")\n"
+        << std::fixed << std::setprecision(3)
+        << ":  " << compaction.last_pause_ms << " ,  "
+        << compaction.max_pause_ms << " ;   " << compaction.last_write_ms << " \n"
+        << ":  " << compaction.last_segments_written
+        << ",   " << compaction.last_segments_reused << "\n";
 }
 
 /**
  * @brief     
  *
  * @details  :
- * 1.   
- * 2.   
- * 3.   :
- *    -   
- *    -  CSV- 
- * 4.    
+ * 1.     ""
+ * 2.     -   :  
+ *     (installIndex),     
+ *       .     
+ *        
+ * 3. ,       -  
+ * 4. ,    CSV- -     
+ *         (LedgerCsv::parse_parallel)
+ * 5.     ,  
+ * 6.     ,   
+ * 7.         
+ * 8.     ,      
  *
- * @throws std::ios_base::failure   
- * @throws std::invalid_argument   
+ * @throws std::runtime_error      
  *
  * @note   ""     
- * @warning      
  */
 void FinanceCore::loadData() {
+    //       ,    
+    if (rates_refresh_.valid()) rates_refresh_.wait();
+    compactor_.reset();
     accounts.clear();
+    exposure_.clear();
+    journal_.reset();
+    store_ = std::make_unique<SegmentStore>(ledgerDir);
     accounts.emplace(std::piecewise_construct,
         std::forward_as_tuple(""),
         std::forward_as_tuple(""));
     currentAccount = &accounts.at("");
 
-    if (!std::filesystem::exists(dataFile)) {
-        std::cout << "[DEBUG]   ,   ''\n";
-        return;
+    LedgerData data;
+    bool migrated = false;
+    if (store_->exists()) {
+        SegmentStore::Index index = store_->read_index();
+        if (index.complete) {
+            data.journal_lsn = index.journal_lsn;
+            installIndex(std::move(index));
+        }
+        else {
+            data = store_->read();
+        }
     }
-
-    std::ifstream file(dataFile);
-    if (!file.is_open()) {
-        std::cerr << "[DEBUG]   \n";
-        throw std::runtime_error("    ");
+    else if (std::filesystem::exists(snapshotFile)) {
+        data = LedgerSnapshot::read(snapshotFile);
+        migrated = true;
+    }
+    else if (std::filesystem::exists(dataFile)) {
+        MappedFile file(dataFile, MappedFile::Access::Sequential);
+        data = LedgerCsv::parse_parallel(file.view());
+        migrated = true;
     }
 
-    std::string line;
-    std::string currentAccountName = "";
-    int max_id = 0;
+    const std::uint64_t snapshot_lsn = data.journal_lsn;
+    if (!data.accounts.empty()) installLedger(std::move(data));
 
-    while (std::getline(file, line)) {
-        if (line.empty()) continue;
+    journal_ = std::make_unique<Journal>(journalFile, snapshot_lsn);
+    size_t replayed = 0;
+    journal_->replay(snapshot_lsn, [this, &replayed](const JournalRecord& record) {
+        applyJournalRecord(record);
+        ++replayed;
+        });
 
-        if (starts_with(line, "[Account:")) {
-            size_t end = line.find(']');
-            if (end == std::string::npos) continue;
+    for (auto& [name, account] : accounts) {
+        if (replayed > 0) account.recalculateBalance(currency_converter_);
+        account.attach_journal(journal_.get());
+    }
 
-            currentAccountName = line.substr(9, end - 9);
-            if (accounts.find(currentAccountName) == accounts.end()) {
-                accounts.emplace(std::piecewise_construct,
-                    std::forward_as_tuple(currentAccountName),
-                    std::forward_as_tuple(currentAccountName));
-            }
-            continue;
+    compactor_ = std::make_unique<SnapshotCompactor>(*journal_, *store_, [this] {
+        LedgerView view;
+        view.accounts.reserve(accounts.size());
+        for (const auto& [name, account] : accounts) {
+            //    :   
+            view.accounts.push_back({ name, account.loaded_snapshot(), account.generation() });
         }
+        return view;
+        });
 
-        Transaction t;
+    if (migrated) {
         try {
-            std::istringstream iss(line);
-            std::vector<std::string> fields;
-            std::string field;
+            compactor_->compact();
+            std::error_code ec;
+            std::filesystem::remove(snapshotFile, ec);
+        }
+        catch (const std::exception& e) {
+            std::cerr << ":    : " << e.what() << "\n";
+        }
+    }
+}
 
-            while (std::getline(iss, field, ',')) {
-                fields.push_back(field);
-            }
+/**
+ * @brief     
+ * @param data  LedgerSnapshot::read  LedgerCsv::read
+ *
+ * @details     Account::assign_transactions
+ *     ,      (
+ *    ),  
+ *  ID   
+ */
+void FinanceCore::installLedger(LedgerData&& data) {
+    for (auto& [name, transactions] : data.accounts) {
+        auto [it, inserted] = accounts.emplace(std::piecewise_construct,
+            std::forward_as_tuple(name),
+            std::forward_as_tuple(name));
+        it->second.assign_transactions(std::move(transactions));
+        auto generation = data.generations.find(name);
+        if (generation != data.generations.end()) it->second.restore_generation(generation->second);
+    }
 
-            if (fields.size() < 6) throw std::runtime_error(" ");
+    //  ID 
+    Transaction::id_allocator.seed(data.max_id);
 
-            //  
-            t.id = std::stoi(fields[0]);
-            if (t.id > max_id) max_id = t.id;
+    //  
+    for (auto& [name, account] : accounts) {
+        account.recalculateBalance(currency_converter_);
+    }
+}
 
-            t.amount = std::stod(fields[1]);
-            t.type = static_cast<Transaction::Type>(std::stoi(fields[2]));
-            t.category = fields[3];
+/**
+ * @brief      
+ * @param index  SegmentStore::read_index
+ *
+ * @details   :     
+ *    ,       
+ * .      ,   
+ */
+void FinanceCore::installIndex(SegmentStore::Index&& index) {
+    SegmentStore* store = store_.get();
+    for (auto& entry : index.accounts) {
+        auto [it, inserted] = accounts.emplace(std::piecewise_construct,
+            std::forward_as_tuple(entry.name),
+            std::forward_as_tuple(entry.name));
+        it->second.assign_lazy(static_cast<size_t>(entry.transactions), std::move(entry.totals),
+            [store, name = entry.name] { return store->read_account(name); });
+        it->second.restore_generation(entry.generation);
+        it->second.recalculateBalance(currency_converter_);
+    }
 
-            //  
-            std::istringstream date_iss(fields[4]);
-            int y, m, d;
-            date_iss >> y >> m >> d;
-            t.date = Date(y, m, d);
+    Transaction::id_allocator.seed(index.max_id);
+}
 
-            //  
-            if (fields.size() > 5) {
-                t.currency_ = fields[5];
-                t.currency_.erase(0, t.currency_.find_first_not_of(" \t"));
-                t.currency_.erase(t.currency_.find_last_not_of(" \t") + 1);
-                if (t.currency_.empty()) t.currency_ = "RUB";
+/**
+ * @brief     
+ * @param record ,   
+ *
+ * @details      ,
+ *      .
+ * ,    ( ID,  ),
+ *   ,     CSV
+ */
+void FinanceCore::applyJournalRecord(const JournalRecord& record) {
+    using Op = JournalRecord::Op;
+    try {
+        switch (record.op) {
+        case Op::CreateAccount:
+            accounts.try_emplace(record.account, record.account);
+            break;
+        case Op::DeleteAccount: {
+            auto it = accounts.find(record.account);
+            if (it == accounts.end() || record.account == "") break;
+            if (currentAccount == &it->second) currentAccount = &accounts.at("");
+            accounts.erase(it);
+            break;
+        }
+        case Op::AddTransaction:
+        case Op::AddTransactionF64: {
+            auto [it, inserted] = accounts.try_emplace(record.account, record.account);
+            it->second.addTransaction(*record.transaction);
+            Transaction::id_allocator.seed(record.transaction_id);
+            break;
+        }
+        case Op::RemoveTransaction: {
+            auto it = accounts.find(record.account);
+            if (it != accounts.end()) it->second.removeTransaction(record.transaction_id);
+            break;
+        }
+        case Op::RenameAccount:
+            if (accounts.count(record.account) && !accounts.count(record.target)) {
+                moveAccount(record.account, record.target);
             }
-
-            //  
-            t.description = (fields.size() > 6) ? fields[6] : "--";
-            t.description.erase(0, t.description.find_first_not_of(" \t"));
-            t.description.erase(t.description.find_last_not_of(" \t") + 1);
-
-            //  
-            if (fields.size() > 7 && fields[7] != "-") {
-                std::istringstream tags_stream(fields[7]);
-                std::string tag;
-                while (std::getline(tags_stream, tag, ';')) {
-                    if (!tag.empty()) t.add_tag(tag);
-                }
+            break;
+        case Op::MergeAccount: {
+            auto from = accounts.find(record.account);
+            auto to = accounts.find(record.target);
+            if (from != accounts.end() && to != accounts.end() && from != to) {
+                to->second.merge_account(std::move(from->second), currency_converter_);
             }
-
-            accounts[currentAccountName].addTransaction(t);
+            break;
         }
-        catch (const std::exception& e) {
-            std::cerr << "  : " << e.what()
-                << "\n: " << line << "\n";
         }
     }
+    catch (const std::exception& e) {
+        std::cerr << ":  " << record.lsn << " : " << e.what() << "\n";
+    }
+}
 
-    //  ID 
-    if (max_id > 0) {
-        Transaction::next_id = max_id + 1;
+/**
+ * @brief  ,    
+ * @param name  
+ * @return   
+ *
+ * @details      ,
+ *    ,     .
+ *     Journal::apply_guard(),  
+ *     
+ */
+Account& FinanceCore::openAccount(const std::string& name) {
+    std::shared_lock<std::shared_mutex> cut;
+    if (journal_) cut = journal_->apply_guard();
+    auto [it, inserted] = accounts.try_emplace(name, name);
+    if (inserted && journal_) {
+        journal_->log_create_account(name);
+        it->second.attach_journal(journal_.get());
     }
+    return it->second;
+}
 
-    //  
-    for (auto& [name, account] : accounts) {
+/**
+ * @brief      
+ * @param from  
+ * @param to  
+ * @return      
+ *
+ * @note       -   
+ */
+Account& FinanceCore::moveAccount(const std::string& from, const std::string& to) {
+    Account& source = accounts.at(from);
+    auto [it, inserted] = accounts.emplace(std::piecewise_construct,
+        std::forward_as_tuple(to),
+        std::forward_as_tuple(to));
+    it->second.move_transactions_from(std::move(source));
+
+    //    (   "" )
+    if (from != "") {
+        if (currentAccount == &source) currentAccount = &it->second;
+        accounts.erase(from);
+    }
+    return it->second;
+}
+
+/**
+ * @brief     CSV-
+ * @param path   
+ * @return true   
+ *
+ * @see LedgerCsv::write()
+ */
+bool FinanceCore::exportCsv(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) return false;
+    LedgerCsv::write(file, accounts);
+    return static_cast<bool>(file);
+}
+
+/**
+ * @brief    CSV-
+ * @param path   
+ * @return   
+ * @throws std::runtime_error    
+ *
+ * @details        
+ * (  ).  
+ *   ID,     :
+ *        
+ */
+size_t FinanceCore::importCsv(const std::string& path) {
+    MappedFile file(path, MappedFile::Access::Sequential);
+    LedgerData data = LedgerCsv::parse_parallel(file.view());
+    size_t imported = 0;
+    for (auto& [name, transactions] : data.accounts) {
+        if (transactions.empty()) continue;
+        Account& account = openAccount(name);
+        TransactionId id = Transaction::id_allocator.reserve(static_cast<TransactionId>(transactions.size()));
+        for (size_t row = 0; row < transactions.size(); ++row) {
+            Transaction t = transactions.materialize(row);
+            t.set_id(id++);
+            account.addTransaction(t);
+            ++imported;
+        }
         account.recalculateBalance(currency_converter_);
     }
-}
\ No newline at end of file
+    return imported;
+}
+
+/**
+ * @brief   
+ * @param path   
+ * @return   
+ *
+ * @details       ,
+ *         ID.
+ *      
+ */
+size_t FinanceCore::importStatement(const std::string& path) {
+    MappedFile file(path, MappedFile::Access::Sequential);
+    std::vector<Transaction> transactions = LedgerCsv::parse_statement(file.view());
+    TransactionId id = Transaction::id_allocator.reserve(static_cast<TransactionId>(transactions.size()));
+    for (auto& t : transactions) {
+        t.set_id(id++);
+        currentAccount->addTransaction(t);
+    }
+    currentAccount->recalculateBalance(currency_converter_);
+    return transactions.size();
+}
+
+/**
+ * @brief  CSV-    
+ * @param path   
+ * @throws std::runtime_error     
+ *
+ * @details      MappedLedger: 
+ *     .   
+ *  ,      
+ */
+void FinanceCore::browseCsv(const std::string& path) {
+    MappedLedger ledger(path);
+
+    for (const auto& [name, views] : ledger.accounts()) {
+        if (views.empty()) continue;
+        std::cout << "\n=== " << name << " (" << views.size() << ") ===\n";
+        std::cout << "+------+------------+----------+------------+------------+--------------+\n";
+        std::cout << "|  ID  |        |       |       |      |     |\n";
+        std::cout << "+------+------------+----------+------------+------------+--------------+\n";
+        for (const auto& v : views) {
+            std::cout << "| " << std::setw(4) << v.id << " | "
+                << v.date.to_string() << " | "
+                << std::setw(8) << (v.type == Transaction::Type::INCOME ? "" : "") << " | "
+                << std::setw(10) << std::fixed << std::setprecision(2) << Money(v.amount, Symbol()) << " | "
+                << std::setw(10) << v.currency << " | "
+                << std::setw(12) << v.category.substr(0, 12) << " |\n";
+        }
+        std::cout << "+------+------------+----------+------------+------------+--------------+\n";
+    }
+
+    std::cout << "\nID       (0 - ): ";
+    const TransactionId id = getTransactionId();
+    if (id == 0) return;
+
+    for (const auto& [name, views] : ledger.accounts()) {
+        for (const auto& v : views) {
+            if (v.id != id) continue;
+            Transaction t = MappedLedger::materialize(v);
+            t.set_id(Transaction::id_allocator.next());
+            getCurrentAccount().addTransaction(t);
+            getCurrentAccount().recalculateBalance(currency_converter_);
+            std::cout << "    " << getCurrentAccount().get_name() << ".\n";
+            return;
+        }
+    }
+    std::cout << "  ID " << id << "  .\n";
+}
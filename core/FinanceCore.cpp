@@ -17,6 +17,8 @@
 
 #include "FinanceCore.hpp"
 #include "currency/CurrencyFetcher.hpp"
+#include "storage/Journal.hpp"
+#include "storage/SnapshotCompactor.hpp"
 #include <thread>
 #include <iostream>
 #include <fstream>
@@ -24,10 +26,18 @@
 #include <filesystem>
 #include <numeric>
 #include <future>
+#include <iterator>
+#include <optional>
+#include <shared_mutex>
 #ifdef _WIN32
 #include <windows.h>
 #endif
 
+namespace {
+    constexpr const char* RATES_FILE = "CurrencyDat/currency_rates.json"; ///<   
+    constexpr const char* HISTORY_FILE = "CurrencyDat/rate_history.bin";  ///<    
+}
+
  /**
   * @brief      
   * @param filename  
@@ -53,6 +63,7 @@ std::string FinanceCore::getDataPath(const std::string& filename) {
  * @details :
  * -  currentAccount  ,   ""
  * -    nullptr
+ * -    (. Account::materialize())
  *
  * @note    accounts_mutex_
  */
@@ -60,6 +71,7 @@ Account& FinanceCore::getCurrentAccount() {
     if (!currentAccount) {
         currentAccount = &accounts.at("");
     }
+    currentAccount->materialize();
     return *currentAccount;
 }
 
@@ -92,8 +104,12 @@ void FinanceCore::ensureDefaultAccount() {
  *    - Fallback:  
  * 2.   
  * 3.   
- * 4.    
+ * 4.      (CurrencyDat/currency_rates.json)
  * 5.   
+ * 6.      
+ *
+ * @note     :    
+ *    ,   
  *
  * @throws std::runtime_error    
  */
@@ -115,7 +131,29 @@ FinanceCore::FinanceCore() {
         }
     }
 
+    initialize(dataPath);
+}
+
+/**
+ * @brief       
+ * @param dataPath    ;     
+ *
+ * @details ,      
+ *   (,  )
+ */
+FinanceCore::FinanceCore(const std::filesystem::path& dataPath) {
+    initialize(dataPath);
+}
+
+/**
+ * @brief   :  2-6
+ * @param dataPath    
+ */
+void FinanceCore::initialize(const std::filesystem::path& dataPath) {
     dataFile = dataPath.string();
+    snapshotFile = std::filesystem::path(dataPath).replace_extension(".snap").string();
+    ledgerDir = std::filesystem::path(dataPath).replace_extension(".ledger").string();
+    journalFile = std::filesystem::path(dataPath).replace_extension(".journal").string();
     std::cout << "    : " << dataFile << std::endl;
 
     //  
@@ -126,26 +164,40 @@ FinanceCore::FinanceCore() {
     accounts.try_emplace("", "");
     currentAccount = &accounts.at("");
 
-    //    
-    try {
-        std::promise<bool> promise;
-        auto future = promise.get_future();
-        update_currency_rates([&promise](bool success) {
-            promise.set_value(success);
-            });
-        future.wait();
-
-        if (!future.get()) {
-            std::cout << ":     \n";
-        }
-    }
-    catch (...) {
-        std::cerr << "    \n";
+    //   :    
+    if (!currency_converter_.load_rates_from_file(RATES_FILE)) {
+        std::cout << ":     ,  \n";
     }
+    currency_converter_.load_history_from_file(HISTORY_FILE);
 
     ensureDefaultAccount();
 
     loadData();
+
+    //    ;    
+    rates_refresh_ = std::async(std::launch::async, [this] {
+        try {
+            update_currency_rates([](bool) {});
+        }
+        catch (const std::exception& e) {
+            std::cerr << "    : " << e.what() << "\n";
+        }
+        });
+}
+
+/**
+ * @brief   
+ *
+ * @details      (
+ *   ),    , 
+ *   ,     
+ */
+FinanceCore::~FinanceCore() {
+    if (rates_refresh_.valid()) rates_refresh_.wait();
+    compactor_.reset();
+    for (auto& [name, account] : accounts) {
+        account.attach_journal(nullptr);
+    }
 }
 
 /**
@@ -153,9 +205,8 @@ FinanceCore::FinanceCore() {
  * @return true      
  *
  * @details  :
- * 1.       
- * 2.    
- * 3.  : 0.01 ( )
+ * 1.        (Account::validate)
+ * 2.      :  
  *
  * @note    
  */
@@ -163,12 +214,7 @@ bool FinanceCore::validateData() const {
     if (accounts.empty()) return false;
 
     for (const auto& [name, account] : accounts) {
-        double calculated = 0;
-        for (const auto& t : account.get_transactions()) {
-            calculated += t.get_amount_in_rub(currency_converter_);
-        }
-
-        if (std::abs(calculated - account.get_balance()) > 0.01) {
+        if (!account.validate(currency_converter_)) {
             return false;
         }
     }
@@ -201,6 +247,28 @@ int FinanceCore::getMenuChoice() const {
     }
 }
 
+/**
+ * @brief  ID   
+ * @return  ID
+ *
+ * @details  getMenuChoice(),   64- : ID
+ *     int
+ */
+TransactionId FinanceCore::getTransactionId() const {
+    TransactionId id;
+    while (true) {
+        if (std::cin >> id) {
+            clearInputBuffer();
+            return id;
+        }
+        else {
+            std::cout << " . ,  : ";
+            std::cin.clear();
+            clearInputBuffer();
+        }
+    }
+}
+
 /**
  * @brief   
  *
@@ -245,40 +313,91 @@ void FinanceCore::clearInputBuffer() const {
  * @param callback    (bool success)
  *
  * @details  :
- * 1.  CurrencyFetcher   
- * 2.      
+ * 1.    CurrencyFetcher (    )
+ * 2.            ,
+ *              
  * 3.      
- * 4.  callback  
+ * 4.  :    
+ *    (revalue),      -  (recalculateBalances)
+ * 5.  callback  
  *
- * @note  std::async  
+ * @note       (. )
  */
 void FinanceCore::update_currency_rates(std::function<void(bool)> callback) {
     CurrencyFetcher fetcher;
     fetcher.fetch_rates([this, callback](const auto& new_rates) {
         bool success = false;
+        std::optional<RateDiff> diff;
 
         // 1.  
         if (!new_rates.empty()) {
-            currency_converter_.set_rates(new_rates);
-            currency_converter_.save_rates_to_file("CurrencyDat/currency_rates.json");
+            diff = currency_converter_.set_rates(new_rates);
+            currency_converter_.save_rates_to_file(RATES_FILE);
+            currency_converter_.record_history();
+            try {
+                currency_converter_.save_history_to_file(HISTORY_FILE);
+            }
+            catch (const std::exception& e) {
+                std::cerr << "   : " << e.what() << "\n";
+            }
             success = true;
         }
         else {
-            success = currency_converter_.load_rates_from_file("CurrencyDat/currency_rates.json");
+            success = currency_converter_.load_rates_from_file(RATES_FILE);
         }
 
-        // 2.  
-        if (success) {
-            std::lock_guard<std::mutex> acc_lock(accounts_mutex_);
-            for (auto& [name, account] : accounts) {
-                account.recalculateBalance(currency_converter_);
-            }
+        // 2.  :   ,   
+        if (diff) {
+            revalue(*diff);
+        }
+        else if (success) {
+            recalculateBalances();
         }
 
         callback(success);
         });
 }
 
+/**
+ * @brief    
+ *
+ * @details  Journal::freeze()    ,  
+ *   ;      
+ *   
+ */
+void FinanceCore::recalculateBalances() {
+    std::unique_lock<std::shared_mutex> cut;
+    if (journal_) cut = journal_->freeze();
+    for (auto& [name, account] : accounts) {
+        account.recalculateBalance(currency_converter_);
+    }
+}
+
+/**
+ * @brief   ,   
+ *
+ * @details       : 
+ *    ,    ,
+ *     
+ */
+void FinanceCore::revalue(const RateDiff& diff) {
+    if (diff.empty()) return;
+    if (diff.affects(Symbol("RUB"))) {
+        recalculateBalances();
+        return;
+    }
+
+    std::unique_lock<std::shared_mutex> cut;
+    if (journal_) cut = journal_->freeze();
+    const auto changed = exposure_.sync(accounts);
+    const auto exposed = exposure_.holders(diff.changed);
+    std::vector<std::string> stale;
+    std::set_union(changed.begin(), changed.end(), exposed.begin(), exposed.end(), std::back_inserter(stale));
+    for (const auto& name : stale) {
+        accounts.at(name).recalculateBalance(currency_converter_);
+    }
+}
+
 /**
  * @brief    
  * @param amount  
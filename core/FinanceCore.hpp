@@ -23,9 +23,17 @@
 #include <map>
 #include <algorithm>
 #include "Account.hpp"
+#include "ExposureIndex.hpp"
+#include "TransactionQuery.hpp"
 #include "currency/CurrencyConverter.hpp"
+#include "storage/SegmentStore.hpp"
 #include <filesystem>
 #include <future>
+#include <memory>
+
+struct JournalRecord;
+class Journal;
+class SnapshotCompactor;
 
  /**
   * @class FinanceCore
@@ -39,11 +47,62 @@
 class FinanceCore {
 private:
     std::string base_currency_ = "RUB";       ///<    
-    std::string dataFile;                     ///<    
+    std::string dataFile;                     ///<   CSV-  ()
+    std::string snapshotFile;                 ///<      ()
+    std::string ledgerDir;                    ///<   
+    std::string journalFile;                  ///<    
+    std::unique_ptr<Journal> journal_;        ///<   ( accounts)
+    std::unique_ptr<SegmentStore> store_;     ///<    
     std::map<std::string, Account> accounts;  ///<  
+    std::unique_ptr<SnapshotCompactor> compactor_; ///<    ( accounts)
     Account* currentAccount;                  ///<   
     CurrencyConverter currency_converter_;    ///<  
+    ExposureIndex exposure_;                  ///<  ->    (    )
     mutable std::mutex accounts_mutex_;      ///<   
+    std::future<void> rates_refresh_;         ///<   ,   
+
+    /**
+     * @brief     
+     * @param data     CSV
+     */
+    void installLedger(LedgerData&& data);
+
+    /**
+     * @brief       
+     * @param index    
+     */
+    void installIndex(SegmentStore::Index&& index);
+
+    /**
+     * @brief       
+     * @param record ,    
+     */
+    void applyJournalRecord(const JournalRecord& record);
+
+    /**
+     * @brief  ,    
+     * @param name  
+     * @return   
+     * @post     ,   
+     */
+    Account& openAccount(const std::string& name);
+
+    /**
+     * @brief      
+     * @param from  
+     * @param to   (  )
+     * @return      
+     *
+     * @note ""   ,   
+     * @note   renameAccount   
+     */
+    Account& moveAccount(const std::string& from, const std::string& to);
+
+    /**
+     * @brief  ,    
+     * @param dataPath    
+     */
+    void initialize(const std::filesystem::path& dataPath);
 
 public:
     // /
@@ -66,21 +125,70 @@ public:
      */
     FinanceCore();
 
+    /**
+     * @brief     
+     * @param dataPath     (transactions.dat)
+     */
+    explicit FinanceCore(const std::filesystem::path& dataPath);
+
+    /**
+     * @brief      
+     */
+    ~FinanceCore();
+
     /// @name  
     /// @{
     /**
      * @brief    
      * @throws std::ios_base::failure   
-     * @post     
+     * @post     :
+     *  +  ,   
      */
     void loadData();
 
     /**
-     * @brief     
-     * @throws std::ios_base::failure   
-     * @note  : CSV    
+     * @brief      
+     * @note       ,  
+     *       
+     *   ,     
      */
     void saveData();
+
+    /**
+     * @brief     CSV
+     * @param path   
+     * @return true   
+     */
+    bool exportCsv(const std::string& path) const;
+
+    /**
+     * @brief    CSV
+     * @param path   
+     * @return   
+     * @throws std::runtime_error    
+     */
+    size_t importCsv(const std::string& path);
+
+    /**
+     * @brief      
+     * @param path   CSV- 
+     * @return   
+     * @throws std::runtime_error        
+     * @see LedgerCsv::parse_statement()
+     */
+    size_t importStatement(const std::string& path);
+
+    /**
+     * @brief  CSV-   (   )
+     * @param path   
+     * @details       
+     */
+    void browseCsv(const std::string& path);
+
+    /**
+     * @brief       
+     */
+    void showStorageStats() const;
     /// @}
 
     /// @name  
@@ -220,10 +328,30 @@ public:
         const std::string& to = "RUB") const;
 
     /**
-     * @brief    
+     * @brief      
      * @param callback   
+     *
+     * @note    ;     
      */
     void update_currency_rates(std::function<void(bool success)> callback);
+
+    /**
+     * @brief       
+     * @note   Journal::freeze()
+     */
+    void recalculateBalances();
+
+    /**
+     * @brief   ,   
+     * @param diff   (CurrencyConverter::set_rates)
+     *
+     * @details       diff
+     * ( ExposureIndex)  ,    :
+     *           .
+     *    -   -   
+     * @note   Journal::freeze()
+     */
+    void revalue(const RateDiff& diff);
     /// @}
 
     /// @name  
@@ -242,20 +370,33 @@ public:
     void ensureDefaultAccount();
 
     /**
-     * @brief    
-     * @param type   (INCOME/EXPENSE)
-     * @return  
+     * @brief    
+     * @param query  
+     * @return    (  )
      */
-    std::vector<Transaction> getFilteredTransactions(Transaction::Type type) const;
+    TransactionSelection selectTransactions(const TransactionQuery& query) const;
 
     /**
      * @brief   
-     * @param transactions  
+     * @param transactions   
+     * @param title  
+     */
+    void printTransactionsTable(const TransactionSelection& transactions,
+        const std::string& title) const;
+
+    /**
+     * @brief      
+     * @param parts   
      * @param title  
      */
-    void printTransactionsTable(const std::vector<Transaction>& transactions,
+    void printTransactionsTable(const std::vector<TransactionSelection>& parts,
         const std::string& title) const;
 
+    /**
+     * @brief    (   )
+     */
+    void printTransactionRows(const TransactionSelection& transactions) const;
+
     /**
      * @brief     
      * @return   (1-N)
@@ -263,6 +404,13 @@ public:
      */
     int getMenuChoice() const;
 
+    /**
+     * @brief  ID   
+     * @return  ID (64-, . IdAllocator)
+     * @note     
+     */
+    TransactionId getTransactionId() const;
+
     /**
      * @brief   ()
      */
@@ -295,6 +443,11 @@ public:
      * @brief  
      */
     void runSearchMenu();
+
+    /**
+     * @brief  / CSV
+     */
+    void runCsvMenu();
     /// @}
 
     /**
@@ -0,0 +1,66 @@
+/**
+ * @file IdAllocator.hpp
+ * @brief   ID 
+ *
+ * @details   -   64- .  ID
+ *   ,     
+ *  :         ,
+ *     .   
+ *     ID,   ID 
+ *   .
+ *
+ * @par :
+ * @code
+ * TransactionId id = Transaction::id_allocator.reserve(parsed.size());
+ * for (auto& t : parsed) t.set_id(id++);
+ * @endcode
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+using TransactionId = std::int64_t; ///< ID 
+
+ /**
+  * @class IdAllocator
+  * @brief    ID
+  *
+  * @note   . ID ,   
+  *  
+  */
+class IdAllocator {
+public:
+    /**
+     * @brief   ID
+     */
+    TransactionId next() { return next_.fetch_add(1, std::memory_order_relaxed); }
+
+    /**
+     * @brief  count ID 
+     * @return  ID  [first, first + count)
+     */
+    TransactionId reserve(TransactionId count) { return next_.fetch_add(count, std::memory_order_relaxed); }
+
+    /**
+     * @brief      ID
+     * @param used ID,      
+     *
+     * @details   :     used,
+     *   
+     */
+    void seed(TransactionId used) {
+        TransactionId current = next_.load(std::memory_order_relaxed);
+        while (current <= used &&
+            !next_.compare_exchange_weak(current, used + 1, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief ID,     next()
+     */
+    TransactionId peek() const { return next_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<TransactionId> next_{ 1 }; ///<   ID
+};
@@ -0,0 +1,155 @@
+/**
+ * @file IdIndex.hpp
+ * @brief - "ID  ->  "
+ *
+ * @details       
+ *   (16   ,    ):
+ * ,     O(1)  ,   
+ *   .     , 
+ * ""    .
+ */
+
+#pragma once
+#include "IdAllocator.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+ /**
+  * @class IdIndex
+  * @brief  ID     TransactionStore
+  *
+  * @note  :   Account
+  */
+class IdIndex {
+public:
+    static constexpr std::uint32_t NONE = ~std::uint32_t{ 0 }; ///<  "  ID"
+
+    /**
+     * @brief  ID
+     * @param id ID 
+     * @param row  
+     * @return false  ID   (  )
+     */
+    bool insert(TransactionId id, std::uint32_t row) {
+        if ((size_ + 1) * 2 > slots_.size()) grow();
+        for (size_t i = home(id);; i = (i + 1) & mask_) {
+            if (slots_[i].row == NONE) {
+                slots_[i] = { id, row };
+                ++size_;
+                return true;
+            }
+            if (slots_[i].id == id) return false;
+        }
+    }
+
+    /**
+     * @brief    ID
+     * @return    NONE
+     */
+    std::uint32_t find(TransactionId id) const {
+        if (size_ == 0) return NONE;
+        for (size_t i = home(id);; i = (i + 1) & mask_) {
+            if (slots_[i].row == NONE) return NONE;
+            if (slots_[i].id == id) return slots_[i].row;
+        }
+    }
+
+    /**
+     * @brief  ID
+     * @return false  ID  
+     *
+     * @details       ,
+     *         
+     */
+    bool erase(TransactionId id) {
+        if (size_ == 0) return false;
+        size_t hole = home(id);
+        for (;; hole = (hole + 1) & mask_) {
+            if (slots_[hole].row == NONE) return false;
+            if (slots_[hole].id == id) break;
+        }
+        for (size_t i = (hole + 1) & mask_; slots_[i].row != NONE; i = (i + 1) & mask_) {
+            //   i    hole,  hole      home
+            const size_t from_home = (i - home(slots_[i].id)) & mask_;
+            const size_t from_hole = (i - hole) & mask_;
+            if (from_hole <= from_home) {
+                slots_[hole] = slots_[i];
+                hole = i;
+            }
+        }
+        slots_[hole].row = NONE;
+        --size_;
+        return true;
+    }
+
+    /**
+     * @brief     ID
+     * @param ids ID   
+     * @return      ID  NONE
+     *
+     * @details          ID
+     */
+    std::uint32_t assign(const std::vector<TransactionId>& ids) {
+        clear();
+        reserve(ids.size());
+        std::uint32_t duplicate = NONE;
+        for (size_t row = 0; row < ids.size(); ++row) {
+            if (!insert(ids[row], static_cast<std::uint32_t>(row)) && duplicate == NONE) {
+                duplicate = static_cast<std::uint32_t>(row);
+            }
+        }
+        return duplicate;
+    }
+
+    /**
+     * @brief    n   
+     */
+    void reserve(size_t n) {
+        size_t capacity = 16;
+        while (capacity < n * 2) capacity *= 2;
+        if (capacity > slots_.size()) rehash(capacity);
+    }
+
+    void clear() { slots_.clear(); mask_ = 0; shift_ = 64; size_ = 0; } ///<     
+    size_t size() const { return size_; }                  ///<  ID
+
+private:
+    /**
+     * @brief   (row == NONE - )
+     */
+    struct Slot {
+        TransactionId id = 0;     ///< ID 
+        std::uint32_t row = NONE; ///<  
+    };
+
+    /**
+     * @brief    ID ( )
+     *
+     * @details    :    
+     *  ID,    ID    
+     */
+    size_t home(TransactionId id) const {
+        if (shift_ == 64) return 0;
+        return static_cast<size_t>((static_cast<std::uint64_t>(id) * 0x9E3779B97F4A7C15ull) >> shift_);
+    }
+
+    void grow() { rehash(slots_.empty() ? 16 : slots_.size() * 2); }
+
+    void rehash(size_t capacity) {
+        std::vector<Slot> old(capacity);
+        old.swap(slots_);
+        mask_ = capacity - 1;
+        shift_ = 64;
+        for (size_t c = capacity; c > 1; c >>= 1) --shift_;
+        size_ = 0;
+        for (const Slot& slot : old) {
+            if (slot.row != NONE) insert(slot.id, slot.row);
+        }
+    }
+
+    std::vector<Slot> slots_; ///<  ( -  )
+    size_t mask_ = 0;         ///<   - 1
+    unsigned shift_ = 64;     ///< 64 - log2( )
+    size_t size_ = 0;         ///<  
+};
@@ -17,6 +17,7 @@
  */
 
 #include "FinanceCore.hpp"
+#include "storage/Journal.hpp"
 #ifdef _WIN32
 #include <windows.h> //   
 #endif
@@ -91,6 +92,9 @@ void FinanceCore::runMainMenu() {
         case 9:
             runSearchMenu();
             break;
+        case 10:
+            runCsvMenu();
+            break;
         case 0:
             saveData();
             std::cout << "+----------------------------+\n";
@@ -222,9 +226,7 @@ void FinanceCore::createAccount() {
         return;
     }
 
-    accounts.emplace(std::piecewise_construct,
-        std::forward_as_tuple(name),
-        std::forward_as_tuple(name));
+    openAccount(name);
     std::cout << " !\n";
 }
 
@@ -315,6 +317,11 @@ void FinanceCore::deleteAccount() {
         currentAccount = &accounts.at("");
     }
 
+    std::shared_lock<std::shared_mutex> cut;
+    if (journal_) {
+        cut = journal_->apply_guard();
+        journal_->log_delete_account(it->first);
+    }
     accounts.erase(it);
     std::cout << " .\n";
 }
@@ -349,17 +356,16 @@ void FinanceCore::renameAccount() {
     }
 
     //      
-    accounts.emplace(std::piecewise_construct,
-        std::forward_as_tuple(newName),
-        std::forward_as_tuple(newName));
-    accounts.at(newName).move_transactions_from(std::move(*currentAccount));
-
-    //    (   "" )
-    if (currentAccount->get_name() != "") {
-        accounts.erase(currentAccount->get_name());
+    const std::string oldName = currentAccount->get_name();
+    std::shared_lock<std::shared_mutex> cut;
+    if (journal_) {
+        cut = journal_->apply_guard();
+        journal_->log_rename(oldName, newName);
     }
+    Account& renamed = moveAccount(oldName, newName);
+    renamed.attach_journal(journal_.get());
 
-    currentAccount = &accounts.at(newName);
+    currentAccount = &renamed;
     std::cout << " .\n";
 }
 
@@ -431,8 +437,8 @@ void FinanceCore::printMainMenu() const {
     std::cout << "\033[2J\033[1;1H"; // ANSI escape codes
 #endif
 
-    double total_balance = 0;
-    double current_account_balance = 0;
+    Money total_balance;
+    Money current_account_balance;
     for (const auto& [name, account] : accounts) {
         total_balance += account.get_balance_in_currency(currency_converter_, base_currency_);
     }
@@ -458,6 +464,7 @@ void FinanceCore::printMainMenu() const {
     std::cout << "| 7.      |\n";
     std::cout << "| 8.             |\n";
     std::cout << "| 9.                |\n";
+    std::cout << "| 10. / CSV        |\n";
     std::cout << "| 0.                       |\n";
     std::cout << "+-------------------------------+\n";
     std::cout << ">  : ";
@@ -581,4 +588,64 @@ void FinanceCore::runSearchMenu() {
             }
         }
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief  / CSV
+ *
+ * @details :
+ * -     CSV-
+ * -    CSV-   
+ * -  CSV-   (   )
+ * -      
+ * -       
+ *
+ * @note   -  , CSV    
+ * @see FinanceCore::exportCsv()
+ * @see FinanceCore::importCsv()
+ * @see FinanceCore::importStatement()
+ */
+void FinanceCore::runCsvMenu() {
+    std::cout << "\n=== / CSV ==="
+        << "\n1.   CSV"
+        << "\n2.   CSV"
+        << "\n3.  CSV  "
+        << "\n4.   "
+        << "\n5.  "
+        << "\n0. "
+        << "\n : ";
+
+    int choice = getMenuChoice();
+    if (choice == 5) {
+        showStorageStats();
+        std::cout << " Enter  ...";
+        std::cin.get();
+        return;
+    }
+    if (choice < 1 || choice > 4) return;
+
+    std::cout << "  : ";
+    std::string path;
+    std::getline(std::cin, path);
+
+    try {
+        if (choice == 1) {
+            std::cout << (exportCsv(path) ? " .\n" : "  !\n");
+        }
+        else if (choice == 2) {
+            std::cout << " : " << importCsv(path) << "\n";
+        }
+        else if (choice == 4) {
+            std::cout << "   " << currentAccount->get_name() << ": "
+                << importStatement(path) << "\n";
+        }
+        else {
+            browseCsv(path);
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << ": " << e.what() << "\n";
+    }
+    std::cout << " Enter  ...";
+    std::cin.get();
+}
@@ -0,0 +1,203 @@
+/**
+ * @file Money.hpp
+ * @brief     
+ *
+ * @details       
+ * (, )    :
+ * -    ,  
+ * -       
+ * -   -   ,  
+ *
+ * @section money_rounding  
+ *   ( ,   , 
+ *   double)      
+ * " -  ": 0.005 -> 0.01, -0.005 -> -0.01.
+ */
+
+#pragma once
+#include "StringPool.hpp"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+ /**
+  * @class Money
+  * @brief     
+  *
+  * @note     (Money())   
+  *    -      
+  */
+class Money {
+public:
+    static constexpr std::int64_t SCALE = 100;   ///<     
+    static constexpr size_t MAX_CHARS = 24;      ///<    
+
+    /**
+     * @brief    
+     */
+    constexpr Money() = default;
+
+    /**
+     * @brief    
+     * @param minor    ()
+     * @param currency  
+     */
+    Money(std::int64_t minor, Symbol currency) : minor_(minor), currency_(currency) {}
+
+    /**
+     * @brief    
+     * @param value    
+     * @param currency  
+     * @throws std::overflow_error       
+     */
+    static Money from_double(double value, Symbol currency) {
+        return Money(round_minor(value * SCALE), currency);
+    }
+
+    /**
+     * @brief       
+     * @param minor   
+     * @return    " -  "
+     * @throws std::overflow_error        int64
+     */
+    static std::int64_t round_minor(double minor) {
+        if (!(std::fabs(minor) < 9.2e18)) throw std::overflow_error("   ");
+        return static_cast<std::int64_t>(std::llround(minor));
+    }
+
+    /**
+     * @brief      
+     * @param s   [-+]123[.45]
+     * @param minor [out]   
+     * @return false       (, 1e+06)
+     *
+     * @details      
+     *  " -  "
+     */
+    static bool parse_minor(std::string_view s, std::int64_t& minor) {
+        bool negative = false;
+        if (!s.empty() && (s.front() == '-' || s.front() == '+')) {
+            negative = s.front() == '-';
+            s.remove_prefix(1);
+        }
+        std::int64_t units = 0;
+        size_t i = 0;
+        for (; i < s.size() && s[i] >= '0' && s[i] <= '9'; ++i) {
+            if (units > (std::numeric_limits<std::int64_t>::max() / SCALE - 9) / 10) return false;
+            units = units * 10 + (s[i] - '0');
+        }
+        const size_t int_digits = i;
+        std::int64_t fraction = 0;
+        size_t frac_digits = 0;
+        if (i < s.size() && s[i] == '.') {
+            for (++i; i < s.size() && s[i] >= '0' && s[i] <= '9'; ++i, ++frac_digits) {
+                if (frac_digits < 2) fraction = fraction * 10 + (s[i] - '0');
+                else if (frac_digits == 2 && s[i] >= '5') ++fraction; //  -  
+            }
+        }
+        if (i != s.size() || int_digits + frac_digits == 0) return false;
+        if (frac_digits == 1) fraction *= 10;
+        minor = units * SCALE + fraction;
+        if (negative) minor = -minor;
+        return true;
+    }
+
+    /// @name 
+    /// @{
+    std::int64_t minor_units() const { return minor_; }         ///<   
+    Symbol currency() const { return currency_; }               ///<  
+    double to_double() const { return static_cast<double>(minor_) / SCALE; } ///<     
+    bool is_zero() const { return minor_ == 0; }                ///<   
+    bool is_negative() const { return minor_ < 0; }             ///<   
+    /// @}
+
+    /// @name    
+    /// @{
+    Money& operator+=(Money other) {
+        adopt(other);
+        if ((other.minor_ > 0 && minor_ > std::numeric_limits<std::int64_t>::max() - other.minor_) ||
+            (other.minor_ < 0 && minor_ < std::numeric_limits<std::int64_t>::min() - other.minor_)) {
+            throw std::overflow_error(" ");
+        }
+        minor_ += other.minor_;
+        return *this;
+    }
+
+    Money& operator-=(Money other) { return *this += -other; }
+
+    Money operator-() const {
+        if (minor_ == std::numeric_limits<std::int64_t>::min()) throw std::overflow_error(" ");
+        return Money(-minor_, currency_);
+    }
+
+    friend Money operator+(Money a, Money b) { return a += b; }
+    friend Money operator-(Money a, Money b) { return a -= b; }
+    /// @}
+
+    /// @name 
+    /// @{
+    friend bool operator==(Money a, Money b) { return a.minor_ == b.minor_ && a.currency_ == b.currency_; }
+    friend bool operator!=(Money a, Money b) { return !(a == b); }
+    friend bool operator<(Money a, Money b) { a.adopt(b); return a.minor_ < b.minor_; }
+    friend bool operator>(Money a, Money b) { return b < a; }
+    /// @}
+
+    /**
+     * @brief     -123.45   
+     * @param out    MAX_CHARS 
+     * @return     
+     */
+    char* format(char* out) const {
+        //    : -INT64_MIN    int64
+        std::uint64_t value = minor_ < 0 ? 0 - static_cast<std::uint64_t>(minor_) : static_cast<std::uint64_t>(minor_);
+        char digits[MAX_CHARS];
+        size_t n = 0;
+        do {
+            digits[n++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0 || n < 3);
+        if (minor_ < 0) *out++ = '-';
+        while (n > 2) *out++ = digits[--n];
+        *out++ = '.';
+        *out++ = digits[1];
+        *out++ = digits[0];
+        return out;
+    }
+
+    /**
+     * @brief    -123.45 (  )
+     */
+    std::string to_string() const {
+        char buf[MAX_CHARS];
+        return std::string(buf, format(buf));
+    }
+
+    /**
+     * @brief     -123.45
+     * @note   ,  std::setw    
+     */
+    friend std::ostream& operator<<(std::ostream& os, Money m) {
+        char buf[MAX_CHARS];
+        return os << std::string_view(buf, static_cast<size_t>(m.format(buf) - buf));
+    }
+
+private:
+    /**
+     * @brief   
+     * @throws std::invalid_argument   
+     */
+    void adopt(Money& other) {
+        if (currency_ == other.currency_) return;
+        if (currency_.empty() && minor_ == 0) currency_ = other.currency_;
+        else if (other.currency_.empty() && other.minor_ == 0) other.currency_ = currency_;
+        else throw std::invalid_argument("     : "
+            + std::string(currency_.view()) + "  " + std::string(other.currency_.view()));
+    }
+
+    std::int64_t minor_ = 0; ///<   ()
+    Symbol currency_;        ///<  
+};
@@ -19,6 +19,70 @@
 
 #include "FinanceCore.hpp"
 #include <iomanip>
+#include <unordered_map>
+
+namespace {
+
+    /**
+     * @brief     
+     * @param groups    Symbol
+     * @return  (, )  
+     *
+     * @details     , 
+     *      
+     */
+    template <typename Value>
+    std::vector<std::pair<Symbol, Value>> by_name(const std::unordered_map<Symbol, Value>& groups) {
+        std::vector<std::pair<Symbol, Value>> sorted(groups.begin(), groups.end());
+        std::sort(sorted.begin(), sorted.end(),
+            [](const auto& a, const auto& b) { return a.first.view() < b.first.view(); });
+        return sorted;
+    }
+
+    /**
+     * @brief       
+     */
+    struct Turnover {
+        Money income;   ///<  
+        Money expenses; ///<   ()
+
+        void add(Transaction::Type type, Money amount) {
+            (type == Transaction::Type::INCOME ? income : expenses) += amount;
+        }
+    };
+
+    /**
+     * @brief       
+     *
+     * @details       , 
+     * ;  -    (, ),  
+     *   (. Account.hpp)
+     */
+    template <typename Key>
+    using Grouped = std::unordered_map<Key, std::unordered_map<Symbol, Turnover>>;
+
+    /**
+     * @brief      
+     * @param groups     
+     * @param converter  
+     * @param currency  
+     * @return  -> (, )
+     */
+    template <typename Key, typename Map = std::unordered_map<Key, std::pair<Money, Money>>>
+    Map convert_groups(const Grouped<Key>& groups, const CurrencyConverter& converter, std::string_view currency) {
+        Map result;
+        const Symbol target(currency);
+        for (const auto& [key, by_currency] : groups) {
+            auto& [income, expenses] = result[key];
+            for (const auto& [code, turnover] : by_currency) {
+                income += converter.convert(turnover.income, target);
+                expenses += converter.convert(turnover.expenses, target);
+            }
+        }
+        return result;
+    }
+
+} // namespace
 
  /**
   * @brief      
@@ -40,23 +104,15 @@
   */
 
 void FinanceCore::showTotalBalance() const {
-    double totalIncome = 0;
-    double totalExpenses = 0;
+    Money totalIncome;
+    Money totalExpenses;
 
+    //         ( )
+    const Symbol base(base_currency_);
     for (const auto& [name, account] : accounts) {
-        for (const auto& t : account.get_transactions()) {
-            double amount = currency_converter_.convert(
-                t.get_amount(),
-                t.get_currency(),
-                base_currency_
-            );
-
-            if (t.get_type() == Transaction::Type::INCOME) {
-                totalIncome += amount;
-            }
-            else {
-                totalExpenses += amount;
-            }
+        for (const auto& totals : account.totals_by_currency()) {
+            totalIncome += currency_converter_.convert(totals.income, base);
+            totalExpenses += currency_converter_.convert(totals.expenses, base);
         }
     }
 
@@ -80,27 +136,26 @@ void FinanceCore::showTotalBalance() const {
  * @warning       " "
  */
 void FinanceCore::showByCategory() const {
-    std::map<std::string, std::pair<double, double>> categories;
+    Grouped<Symbol> grouped;
 
+    //   :     
     for (const auto& [name, account] : accounts) {
-        for (const auto& t : account.get_transactions()) {
-            double amount = t.get_amount_in_rub(currency_converter_);
-            if (t.get_type() == Transaction::Type::INCOME) {
-                categories[t.get_category()].first += amount;
-            }
-            else {
-                categories[t.get_category()].second += amount;
-            }
+        const TransactionStore& store = account.get_transactions();
+        const auto& categories = store.categories();
+        const auto& currencies = store.currencies();
+        for (size_t row = 0; row < store.size(); ++row) {
+            grouped[categories[row]][currencies[row]].add(store.types()[row], Money(store.amounts()[row], currencies[row]));
         }
     }
+    const auto categories = convert_groups(grouped, currency_converter_, "RUB");
 
     std::cout << "\n===    (" << base_currency_ << ") ===\n";
     std::cout << "+----------------------+----------------+----------------+----------------+\n";
     std::cout << "|             |          |         |           |\n";
     std::cout << "+----------------------+----------------+----------------+----------------+\n";
 
-    for (const auto& [category, amounts] : categories) {
-        std::string cat_display = category.empty() ? " " : category;
+    for (const auto& [category, amounts] : by_name(categories)) {
+        std::string cat_display = category.empty() ? " " : std::string(category.view());
         if (cat_display.length() > 20) cat_display = cat_display.substr(0, 17) + "...";
 
         std::cout << "| " << std::left << std::setw(20) << cat_display << " | "
@@ -132,22 +187,19 @@ void FinanceCore::showByCategory() const {
  */
 void FinanceCore::showByMonth() const {
   //  std::lock_guard<std::mutex> lock(accounts_mutex_);
-    std::map<std::pair<int, int>, std::pair<double, double>> monthly_stats;
+    //  - Date::month_key():  * 12 +  - 1
+    Grouped<int> grouped;
 
     for (const auto& [name, account] : accounts) {
-        for (const auto& t : account.get_transactions()) {
-            const Date& date = t.get_date();
-            auto month_key = std::make_pair(date.get_year(), date.get_month());
-            double amount = t.get_amount_in_rub(currency_converter_);
-
-            if (t.get_type() == Transaction::Type::INCOME) {
-                monthly_stats[month_key].first += amount;
-            }
-            else {
-                monthly_stats[month_key].second += amount;
-            }
+        const TransactionStore& store = account.get_transactions();
+        const auto& dates = store.dates();
+        const auto& currencies = store.currencies();
+        for (size_t row = 0; row < store.size(); ++row) {
+            grouped[dates[row].month_key()][currencies[row]].add(store.types()[row], Money(store.amounts()[row], currencies[row]));
         }
     }
+    const auto monthly_stats = convert_groups<int, std::map<int, std::pair<Money, Money>>>(
+        grouped, currency_converter_, "RUB");
 
     clearConsole();
     std::cout << "\n===    ( RUB) ===\n";
@@ -156,8 +208,9 @@ void FinanceCore::showByMonth() const {
     std::cout << "+------------+--------------+--------------+--------------+\n";
 
     for (const auto& [month, amounts] : monthly_stats) {
-        std::string month_str = std::to_string(month.first) + "-" +
-            (month.second < 10 ? "0" : "") + std::to_string(month.second);
+        const int month_number = month % 12 + 1;
+        std::string month_str = std::to_string(month / 12) + "-" +
+            (month_number < 10 ? "0" : "") + std::to_string(month_number);
 
         std::cout << "| " << std::setw(10) << month_str << " | "
             << std::setw(12) << std::fixed << std::setprecision(2) << amounts.first << " | "
@@ -190,20 +243,16 @@ void FinanceCore::showCurrentAccountStats() const {
         return;
     }
 
-    double income = 0;
-    double expenses = 0;
-    std::map<std::string, double> byCurrency;
-
+    std::unordered_map<Symbol, Turnover> byCurrency;
     for (const auto& t : currentAccount->get_transactions()) {
-        double amount = t.get_amount_in_rub(currency_converter_);
-        byCurrency[t.get_currency()] += t.get_signed_amount();
+        byCurrency[t.get_currency_symbol()].add(t.get_type(), t.get_amount());
+    }
 
-        if (t.get_type() == Transaction::Type::INCOME) {
-            income += amount;
-        }
-        else {
-            expenses += amount;
-        }
+    Money income;
+    Money expenses;
+    for (const auto& [currency, turnover] : byCurrency) {
+        income += currency_converter_.convert(turnover.income, "RUB");
+        expenses += currency_converter_.convert(turnover.expenses, "RUB");
     }
 
     std::cout << "\n===  (" << currentAccount->get_name() << ") ===\n"
@@ -212,10 +261,11 @@ void FinanceCore::showCurrentAccountStats() const {
         << ": " << expenses << " .\n"
         << "\n :\n";
 
-    for (const auto& [currency, amount] : byCurrency) {
+    for (const auto& [currency, turnover] : by_name(byCurrency)) {
+        const Money amount = turnover.income - turnover.expenses;
         std::cout << "  " << currency << ": " << amount;
-        if (currency != "RUB") {
-            std::cout << " (?" << convert_currency(amount, currency, "RUB") << " .)";
+        if (currency.view() != "RUB") {
+            std::cout << " (?" << currency_converter_.convert(amount, "RUB") << " .)";
         }
         std::cout << "\n";
     }
@@ -232,17 +282,17 @@ void FinanceCore::showCurrentAccountStats() const {
  * @note      CurrencyConverter
  */
 void FinanceCore::showBalanceByCurrency() const {
-    std::map<std::string, double> balances;
+    std::unordered_map<Symbol, Money> balances;
 
     //     
     for (const auto& [name, account] : accounts) {
         for (const auto& t : account.get_transactions()) {
-            balances[t.get_currency()] += t.get_signed_amount();
+            balances[t.get_currency_symbol()] += t.get_signed_amount();
         }
     }
 
     std::cout << "\n===    ===\n";
-    for (const auto& [currency, amount] : balances) {
+    for (const auto& [currency, amount] : by_name(balances)) {
         std::cout << currency << ": " << std::fixed << std::setprecision(2) << amount << "\n";
     }
     std::cout << "\n Enter  ...";
@@ -256,7 +306,8 @@ void FinanceCore::showBalanceByCurrency() const {
  * @param tags    
  *
  * @details  :
- * 1.       (AND-)
+ * 1.  ,        :
+ *          
  * 2.     
  * 3.   
  *
@@ -272,19 +323,12 @@ void FinanceCore::searchByTags(const std::vector<std::string>& tags) const {
         return;
     }
 
-    std::vector<Transaction> result;
-
+    //   :    
+    TransactionQuery query;
+    query.any_tag(tags);
+    std::vector<TransactionSelection> result;
     for (const auto& [name, account] : accounts) {
-        for (const auto& t : account.get_transactions()) {
-            const auto& transaction_tags = t.get_tags();
-            if (std::any_of(tags.begin(), tags.end(),
-                [&](const auto& tag) {
-                    return std::find(transaction_tags.begin(),
-                        transaction_tags.end(), tag) != transaction_tags.end();
-                })) {
-                result.push_back(t);
-            }
-        }
+        result.push_back(query.select(account.snapshot()));
     }
 
     clearConsole();
@@ -0,0 +1,75 @@
+/**
+ * @file StringPool.cpp
+ * @brief    
+ */
+
+#include "StringPool.hpp"
+#include <mutex>
+#include <stdexcept>
+
+/**
+ * @brief        EMPTY
+ */
+StringPool::StringPool() {
+    intern("");
+}
+
+/**
+ * @brief   
+ * @param s 
+ * @return 
+ *
+ * @details     ( ), 
+ *    ;    
+ * .     
+ * ,  view()    
+ */
+std::uint32_t StringPool::intern(std::string_view s) {
+    //        
+    thread_local std::unordered_map<std::string_view, std::uint32_t> cache;
+    auto cached = cache.find(s);
+    if (cached != cache.end()) return cached->second;
+
+    const std::uint32_t id = intern_shared(s);
+    cache.emplace(view(id), id);
+    return id;
+}
+
+/**
+ * @brief      
+ */
+std::uint32_t StringPool::intern_shared(std::string_view s) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = index_.find(s);
+        if (it != index_.end()) return it->second;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = index_.find(s);
+    if (it != index_.end()) return it->second;
+
+    const auto id = static_cast<std::uint32_t>(storage_.size());
+    if (id >= CHUNK_SIZE * MAX_CHUNKS) throw std::length_error("  ");
+
+    const std::string_view stored = storage_.emplace_back(s);
+    Chunk* chunk = chunks_[id >> CHUNK_BITS].load(std::memory_order_relaxed);
+    if (!chunk) {
+        chunk = new Chunk();
+        (*chunk)[id & (CHUNK_SIZE - 1)] = stored;
+        chunks_[id >> CHUNK_BITS].store(chunk, std::memory_order_release);
+    }
+    else {
+        (*chunk)[id & (CHUNK_SIZE - 1)] = stored;
+    }
+    index_.emplace(stored, id);
+    return id;
+}
+
+/**
+ * @brief     ( )
+ */
+size_t StringPool::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return storage_.size();
+}
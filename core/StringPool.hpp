@@ -0,0 +1,141 @@
+/**
+ * @file StringPool.hpp
+ * @brief    
+ *
+ * @details ,      -, 
+ *  - .        ,
+ *    32-  (Symbol):
+ * -    -   
+ * -      
+ * -    string_view,    
+ *
+ *    :    .
+ *
+ * @section pool_threads 
+ *    .   
+ *    :   , 
+ *     ,   .
+ */
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+ /**
+  * @class StringPool
+  * @brief       
+  *
+  * @note    : string_view  
+  *       
+  */
+class StringPool {
+public:
+    static constexpr std::uint32_t EMPTY = 0; ///<   
+
+    /**
+     * @brief  
+     */
+    static StringPool& instance() {
+        static StringPool* pool = new StringPool();
+        return *pool;
+    }
+
+    /**
+     * @brief   ,    
+     * @param s 
+     * @return  (   )
+     * @throws std::length_error   
+     */
+    std::uint32_t intern(std::string_view s);
+
+    /**
+     * @brief   
+     * @param id ,   intern()
+     * @return   
+     */
+    std::string_view view(std::uint32_t id) const {
+        const Chunk* chunk = chunks_[id >> CHUNK_BITS].load(std::memory_order_acquire);
+        return (*chunk)[id & (CHUNK_SIZE - 1)];
+    }
+
+    /**
+     * @brief    
+     */
+    size_t size() const;
+
+private:
+    static constexpr unsigned CHUNK_BITS = 10;                   ///< log2  
+    static constexpr std::uint32_t CHUNK_SIZE = 1u << CHUNK_BITS; ///<   
+    static constexpr std::uint32_t MAX_CHUNKS = 1u << 12;        ///< : 4 
+    using Chunk = std::array<std::string_view, CHUNK_SIZE>;
+
+    StringPool();
+    StringPool(const StringPool&) = delete;
+    std::uint32_t intern_shared(std::string_view s);
+    StringPool& operator=(const StringPool&) = delete;
+
+    std::array<std::atomic<Chunk*>, MAX_CHUNKS> chunks_{};       ///<   -> 
+    mutable std::shared_mutex mutex_;                            ///<  index_  storage_
+    std::unordered_map<std::string_view, std::uint32_t> index_;  ///<  -> 
+    std::deque<std::string> storage_;                            ///<  (  )
+};
+
+/**
+ * @class Symbol
+ * @brief  : 4   std::string
+ *
+ * @details     Symbol.  operator<
+ * -    ,   :   
+ *    view()
+ */
+class Symbol {
+public:
+    /**
+     * @brief  
+     */
+    constexpr Symbol() = default;
+
+    /**
+     * @brief  
+     * @param s 
+     */
+    explicit Symbol(std::string_view s) : id_(StringPool::instance().intern(s)) {}
+
+    /**
+     * @brief   
+     */
+    std::string_view view() const { return StringPool::instance().view(id_); }
+
+    /**
+     * @brief        
+     */
+    operator std::string_view() const { return view(); }
+
+    std::uint32_t id() const { return id_; }                   ///<   
+    bool empty() const { return id_ == StringPool::EMPTY; }    ///<   
+
+    friend bool operator==(Symbol a, Symbol b) { return a.id_ == b.id_; }
+    friend bool operator!=(Symbol a, Symbol b) { return a.id_ != b.id_; }
+    friend bool operator<(Symbol a, Symbol b) { return a.id_ < b.id_; }
+
+    friend std::ostream& operator<<(std::ostream& os, Symbol s) { return os << s.view(); }
+
+private:
+    std::uint32_t id_ = StringPool::EMPTY; ///<   
+};
+
+namespace std {
+    ///  Symbol -  
+    template <>
+    struct hash<Symbol> {
+        size_t operator()(Symbol s) const noexcept { return s.id(); }
+    };
+}
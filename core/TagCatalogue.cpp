@@ -0,0 +1,83 @@
+/**
+ * @file TagCatalogue.cpp
+ * @brief     
+ */
+
+#include "TagCatalogue.hpp"
+#include "StringPool.hpp"
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+    /**
+     * @brief ,    
+     *
+     * @details    StringPool:  
+     *     
+     */
+    struct Registry {
+        std::mutex mutex;                                          ///<  
+        std::atomic<int> used{ static_cast<int>(TagCatalogue::BUILTIN.size()) }; ///<  
+        std::array<std::atomic<std::uint32_t>, TagCatalogue::CAPACITY> names{}; ///<  ->  
+    };
+
+    Registry& registry() {
+        static Registry* instance = new Registry();
+        return *instance;
+    }
+
+    /**
+     * @brief   
+     * @return    -1
+     */
+    int find_registered(const Registry& r, std::string_view name) {
+        const int used = r.used.load(std::memory_order_acquire);
+        for (int bit = static_cast<int>(TagCatalogue::BUILTIN.size()); bit < used; ++bit) {
+            if (StringPool::instance().view(r.names[bit].load(std::memory_order_acquire)) == name) {
+                return bit;
+            }
+        }
+        return -1;
+    }
+
+} // namespace
+
+int TagCatalogue::find(std::string_view name) {
+    const int bit = builtin_bit(name);
+    return bit >= 0 ? bit : find_registered(registry(), name);
+}
+
+int TagCatalogue::bit(std::string_view name) {
+    int bit = find(name);
+    if (bit >= 0) return bit;
+
+    Registry& r = registry();
+    std::lock_guard lock(r.mutex);
+    bit = find_registered(r, name);
+    if (bit >= 0) return bit;
+
+    bit = r.used.load(std::memory_order_relaxed);
+    if (bit >= static_cast<int>(CAPACITY)) {
+        throw std::length_error("  :  '" + std::string(name) + "'  ");
+    }
+    r.names[bit].store(StringPool::instance().intern(name), std::memory_order_release);
+    r.used.store(bit + 1, std::memory_order_release);
+    return bit;
+}
+
+std::string_view TagCatalogue::name(int bit) {
+    if (bit < static_cast<int>(BUILTIN.size())) return BUILTIN[bit];
+    return StringPool::instance().view(registry().names[bit].load(std::memory_order_acquire));
+}
+
+std::vector<std::string_view> TagCatalogue::names(TagMask mask) {
+    std::vector<std::string_view> result;
+    result.reserve(count(mask));
+    for (int bit = 0; mask != 0; ++bit, mask >>= 1) {
+        if (mask & 1) result.push_back(name(bit));
+    }
+    return result;
+}
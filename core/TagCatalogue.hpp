@@ -0,0 +1,159 @@
+/**
+ * @file TagCatalogue.hpp
+ * @brief       
+ *
+ * @details     64-  (TagMask):
+ * -  0..26 -  ;     
+ *   -,     
+ * -  27..63 - ,    ; 
+ *      ,    
+ *
+ *       (mask & query) != 0.
+ */
+
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+using TagMask = std::uint64_t; ///<  :    
+
+namespace tag_catalogue_detail {
+
+    ///   (   )
+    constexpr std::array<std::string_view, 27> BUILTIN = {
+        "", "", "",
+        "", "", "", "",
+        "", "", "", "",
+        "", "", "", "",
+        "", "", "",
+        "", "", "",
+        "", "", "",
+        "", "", ""
+    };
+
+    constexpr size_t SLOT_COUNT = 128; ///<    
+
+    /**
+     * @brief FNV-1a  
+     */
+    constexpr std::uint32_t hash(std::string_view s, std::uint32_t seed) {
+        std::uint32_t h = 2166136261u ^ seed;
+        for (char c : s) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 16777619u;
+        }
+        return h;
+    }
+
+    /**
+     * @brief  ,      
+     */
+    constexpr std::uint32_t find_seed() {
+        for (std::uint32_t seed = 1; seed < 1000000; ++seed) {
+            bool used[SLOT_COUNT] = {};
+            bool ok = true;
+            for (std::string_view tag : BUILTIN) {
+                const size_t slot = hash(tag, seed) % SLOT_COUNT;
+                if (used[slot]) {
+                    ok = false;
+                    break;
+                }
+                used[slot] = true;
+            }
+            if (ok) return seed;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief    ->    
+     */
+    constexpr std::array<std::int8_t, SLOT_COUNT> build_slots(std::uint32_t seed) {
+        std::array<std::int8_t, SLOT_COUNT> slots{};
+        for (auto& slot : slots) slot = -1;
+        for (size_t i = 0; i < BUILTIN.size(); ++i) {
+            slots[hash(BUILTIN[i], seed) % SLOT_COUNT] = static_cast<std::int8_t>(i);
+        }
+        return slots;
+    }
+
+    constexpr std::uint32_t SEED = find_seed(); ///<   
+    static_assert(SEED != 0, "   -   ");
+    constexpr std::array<std::int8_t, SLOT_COUNT> SLOTS = build_slots(SEED); ///<  -> 
+
+} // namespace tag_catalogue_detail
+
+ /**
+  * @class TagCatalogue
+  * @brief      
+  *
+  * @note  
+  */
+class TagCatalogue {
+public:
+    static constexpr size_t CAPACITY = 64; ///<    
+
+    ///   (   )
+    static constexpr const auto& BUILTIN = tag_catalogue_detail::BUILTIN;
+
+    /**
+     * @brief   
+     * @param name  
+     * @return    -1,    
+     *
+     * @details   ,    
+     *    ;   
+     */
+    static constexpr int builtin_bit(std::string_view name) {
+        using namespace tag_catalogue_detail;
+        const int bit = SLOTS[hash(name, SEED) % SLOT_COUNT];
+        return (bit >= 0 && BUILTIN[bit] == name) ? bit : -1;
+    }
+
+    /**
+     * @brief  ,   
+     * @param name  
+     * @return    -1
+     */
+    static int find(std::string_view name);
+
+    /**
+     * @brief      
+     * @param name   ( )
+     * @return  
+     * @throws std::length_error   64  
+     */
+    static int bit(std::string_view name);
+
+    /**
+     * @brief     
+     * @param bit  ,   bit()  find()
+     */
+    static std::string_view name(int bit);
+
+    /**
+     * @brief      
+     */
+    static std::vector<std::string_view> names(TagMask mask);
+
+    /**
+     * @brief    
+     */
+    static constexpr int count(TagMask mask) {
+        int n = 0;
+        for (; mask != 0; mask &= mask - 1) ++n;
+        return n;
+    }
+
+    /**
+     * @brief    
+     * @param mask  
+     */
+    static constexpr int lowest(TagMask mask) {
+        int bit = 0;
+        for (; (mask & 1) == 0; mask >>= 1) ++bit;
+        return bit;
+    }
+};
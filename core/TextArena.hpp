@@ -0,0 +1,106 @@
+/**
+ * @file TextArena.hpp
+ * @brief     
+ *
+ * @details        
+ *    -     .  
+ *   ,   ,  
+ *       .
+ */
+
+#pragma once
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+ /**
+  * @class TextArena
+  * @brief    
+  *
+  * @details  string_view ,   
+  * (     )     clear().
+  *      
+  *
+  * @note  
+  */
+class TextArena {
+public:
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;     ///<   
+    static constexpr size_t LARGE_TEXT = BLOCK_SIZE / 4; ///<     
+
+    TextArena() = default;
+    TextArena(TextArena&&) noexcept = default;
+    TextArena& operator=(TextArena&&) noexcept = default;
+    TextArena(const TextArena&) = delete;
+    TextArena& operator=(const TextArena&) = delete;
+
+    /**
+     * @brief    
+     * @param s 
+     * @return   (    )
+     */
+    std::string_view store(std::string_view s) {
+        if (s.empty()) return {};
+        char* out;
+        if (s.size() > LARGE_TEXT) {
+            //       
+            blocks_.emplace_back(new char[s.size()]);
+            out = blocks_.back().get();
+        }
+        else {
+            if (s.size() > left_) {
+                blocks_.emplace_back(new char[BLOCK_SIZE]);
+                cursor_ = blocks_.back().get();
+                left_ = BLOCK_SIZE;
+            }
+            out = cursor_;
+            cursor_ += s.size();
+            left_ -= s.size();
+        }
+        std::memcpy(out, s.data(), s.size());
+        used_ += s.size();
+        return std::string_view(out, s.size());
+    }
+
+    /**
+     * @brief    
+     * @param other - ( )
+     *
+     * @details  other  :   
+     *      . 
+     *    other  
+     */
+    void splice(TextArena&& other) {
+        if (blocks_.empty()) {
+            *this = std::move(other);
+        }
+        else {
+            blocks_.insert(blocks_.end(), std::make_move_iterator(other.blocks_.begin()),
+                std::make_move_iterator(other.blocks_.end()));
+            used_ += other.used_;
+        }
+        other.clear();
+    }
+
+    /**
+     * @brief   
+     * @post    
+     */
+    void clear() {
+        blocks_.clear();
+        cursor_ = nullptr;
+        left_ = 0;
+        used_ = 0;
+    }
+
+    size_t block_count() const { return blocks_.size(); } ///<   
+    size_t bytes_used() const { return used_; }          ///<    
+
+private:
+    std::vector<std::unique_ptr<char[]>> blocks_; ///<  ()
+    char* cursor_ = nullptr;                      ///<    
+    size_t left_ = 0;                             ///<     
+    size_t used_ = 0;                             ///<     
+};
@@ -29,7 +29,15 @@
 #include <iostream>
 #include <stdexcept>
 #include "Date.hpp"
+#include "IdAllocator.hpp"
+#include "Money.hpp"
+#include "StringPool.hpp"
+#include "TagCatalogue.hpp"
 #include "currency/CurrencyConverter.hpp"
+#include <algorithm>
+#include <sstream>
+#include <string_view>
+#include <vector>
 
  /**
  * @class Transaction
@@ -41,6 +49,12 @@
  * -     
  * -   
  *
+ * ,     (Symbol): 
+ *     StringPool,    string_view
+ *
+ *       () 
+ *   Money;      Money.hpp
+ *
  * @invariant
  * 1. ID     
  * 2.   
@@ -49,12 +63,16 @@
  */
 class Transaction {
     friend class FinanceCore;
+    friend class LedgerCsv;
+    friend class LedgerSnapshot;
+    friend class Journal;
+    friend class TransactionStore;
 public:
     /**
      * @enum Type
      * @brief   
      */
-    enum class Type { 
+    enum class Type : std::uint8_t {
         INCOME, ///<   ()
         EXPENSE ///<   ()
     };
@@ -69,8 +87,8 @@ public:
      * -  
      */
     Transaction()
-        : id(next_id++),
-        amount(0.0),
+        : id(id_allocator.next()),
+        amount(0),
         category("Uncategorized"),
         type(Type::EXPENSE),
         date(),  //  
@@ -89,6 +107,16 @@ public:
         currency_(other.currency_), tags_(other.tags_) {
     }
 
+    /**
+     * @brief  
+     * @param other -
+     * @note      -    
+     */
+    Transaction(Transaction&& other) noexcept = default;
+
+    Transaction& operator=(const Transaction& other) = default; ///<  
+    Transaction& operator=(Transaction&& other) noexcept = default; ///<  
+
     /**
      * @brief   
      * @param amt  (> 0)
@@ -103,16 +131,32 @@ public:
      * Transaction t(100.0, "Food", Type::EXPENSE, Date(2023, 5, 20), "Supermarket");
      * @endcode
      */
-    Transaction(double amt, const std::string& cat, Type t, const Date& d, const std::string& desc = "")
-        : id(next_id++), amount(amt), category(cat), type(t), date(d), description(desc) {
+    Transaction(double amt, std::string_view cat, Type t, const Date& d, const std::string& desc = "")
+        : id(id_allocator.next()), amount(Money::round_minor(amt * Money::SCALE)), category(cat), type(t), date(d), description(desc) {
+        validation();
+    }
+
+    /**
+     * @brief     
+     * @param amt  (> 0);     
+     * @param cat  ( )
+     * @param t  
+     * @param d  
+     * @param desc  ()
+     * @throws std::invalid_argument   
+     */
+    Transaction(Money amt, std::string_view cat, Type t, const Date& d, const std::string& desc = "")
+        : id(id_allocator.next()), amount(amt.minor_units()), category(cat), type(t), date(d), description(desc),
+        currency_(amt.currency().empty() ? default_currency() : amt.currency()) {
         validation();
     }
 
     /// @name 
     /// @{
-    int get_id() const { return id; }                   ///< @return  ID 
-    double get_amount() const { return amount; }        ///< @return  
-    std::string get_category() const { return category; } ///< @return 
+    TransactionId get_id() const { return id; }         ///< @return  ID 
+    Money get_amount() const { return Money(amount, currency_); } ///< @return     
+    std::string_view get_category() const { return category.view(); } ///< @return 
+    Symbol get_category_symbol() const { return category; } ///< @return   Symbol ( )
     Type get_type() const { return type; }             ///< @return  (INCOME/EXPENSE)
     Date get_date() const { return date; }             ///< @return  
     std::string get_description() const { return description; } ///< @return 
@@ -121,8 +165,8 @@ public:
      * @brief      
      * @return   -  ,   - 
      */
-    double get_signed_amount() const {
-        return (type == Type::INCOME) ? amount : -amount;
+    Money get_signed_amount() const {
+        return Money((type == Type::INCOME) ? amount : -amount, currency_);
     }
 
     /**
@@ -132,7 +176,7 @@ public:
     std::string get_summary() const {
         return date.to_string() + " " +
             (type == Type::INCOME ? "[+] " : "[-] ") +
-            std::to_string(amount) + " (" + category + ") " + description;
+            get_amount().to_string() + " (" + std::string(category.view()) + ") " + description;
     }
     /// @}
 
@@ -140,12 +184,13 @@ public:
     /// @{
     /**
      * @brief   
-     * @param amt   (> 0)
+     * @param amt   (> 0),   
      * @throws std::invalid_argument    
      */
     void set_amount(double amt) {
-        if (amt <= 0) throw std::invalid_argument("Amount must be positive");
-        amount = amt;
+        const std::int64_t minor = amt > 0 ? Money::round_minor(amt * Money::SCALE) : 0;
+        if (minor <= 0) throw std::invalid_argument("Amount must be positive");
+        amount = minor;
     }
 
     /**
@@ -153,9 +198,9 @@ public:
      * @param cat   ( )
      * @throws std::invalid_argument   
      */
-    void set_category(const std::string& cat) {
+    void set_category(std::string_view cat) {
         if (cat.empty()) throw std::invalid_argument("Category cannot be empty");
-        category = cat;
+        category = Symbol(cat);
     }
 
     /**
@@ -173,7 +218,7 @@ public:
     void set_description(const std::string& desc) {    
         description = desc.empty() ? "--" : desc;
     } ///<  
-    void set_id(int new_id) { id = new_id; }           ///<  ID (   )
+    void set_id(TransactionId new_id) { id = new_id; } ///<  ID (   )
     /// @}
 
     /**
@@ -187,7 +232,7 @@ public:
      */
     friend std::ostream& operator<<(std::ostream& os, const Transaction& t) {
         os << t.id << ","
-            << t.amount << ","
+            << t.get_amount() << ","
             << static_cast<int>(t.type) << ","
             << t.category << ","
             << t.date << ","
@@ -213,13 +258,17 @@ public:
         int type;
 
         try {
-            if (!(iss >> t.id >> delim >> t.amount >> delim >> type >> delim)) {
+            std::string amount;
+            if (!(iss >> t.id >> delim) || !std::getline(iss, amount, ',') ||
+                !Money::parse_minor(amount, t.amount) || !(iss >> type >> delim)) {
                 throw std::runtime_error("   ");
             }
             t.type = static_cast<Transaction::Type>(type);
 
             //   ( )
-            std::getline(iss, t.category, ',');
+            std::string field;
+            std::getline(iss, field, ',');
+            t.category = Symbol(field);
 
             //  
             int y, m, d;
@@ -229,7 +278,8 @@ public:
             t.date = Date(y, m, d);
             
             //   - 
-            std::getline(iss, t.currency_, ',');
+            std::getline(iss, field, ',');
+            t.currency_ = Symbol(field);
             std::getline(iss, t.description);
         }
         catch (const std::exception& e) {
@@ -246,21 +296,22 @@ public:
      * @brief   
      * @param currency   ( "USD")
      */
-    void set_currency(const std::string& currency) {
-        currency_ = currency;
+    void set_currency(std::string_view currency) {
+        currency_ = Symbol(currency);
     }
 
     /**
      * @brief    
      * @param converter  
-     * @return   
+     * @return   ,   
      * @throws std::runtime_error    
      */
-    double get_amount_in_rub(const CurrencyConverter& converter) const {
-        return converter.convert(amount, currency_, "RUB");
+    Money get_amount_in_rub(const CurrencyConverter& converter) const {
+        return converter.convert(get_amount(), "RUB");
     }
 
-    const std::string& get_currency() const { return currency_; } ///<   
+    std::string_view get_currency() const { return currency_.view(); } ///<   
+    Symbol get_currency_symbol() const { return currency_; } ///<     Symbol
     /// @}
 
     /// @name   
@@ -269,18 +320,36 @@ public:
      * @brief    
      * @param tag   
      * @throws std::runtime_error      
+     * @throws std::length_error        
      */
-    void Transaction::add_tag(const std::string& tag) {
-        if (tags_.size() >= MAX_TAGS) {
+    void add_tag(std::string_view tag) {
+        if (TagCatalogue::count(tags_) >= static_cast<int>(MAX_TAGS)) {
             throw std::runtime_error("   (" + std::to_string(MAX_TAGS) + ")");
         }
-        if (std::find(tags_.begin(), tags_.end(), tag) != tags_.end()) {
-            throw std::runtime_error(" '" + tag + "'  ");
+        const TagMask bit = TagMask(1) << TagCatalogue::bit(tag);
+        if (tags_ & bit) {
+            throw std::runtime_error(" '" + std::string(tag) + "'  ");
         }
-        tags_.push_back(tag);
+        tags_ |= bit;
     }
 
-    const std::vector<std::string>& get_tags() const { return tags_; } ///<   
+    /**
+     * @brief   
+     * @return      
+     */
+    std::vector<std::string_view> get_tags() const { return TagCatalogue::names(tags_); }
+
+    TagMask get_tag_mask() const { return tags_; } ///<    
+    size_t tag_count() const { return TagCatalogue::count(tags_); } ///<  
+
+    /**
+     * @brief   
+     * @param tag 
+     */
+    bool has_tag(std::string_view tag) const {
+        const int bit = TagCatalogue::find(tag);
+        return bit >= 0 && (tags_ >> bit & 1) != 0;
+    }
 
     /**
      * @brief     
@@ -290,28 +359,58 @@ public:
 
     /**
      * @brief    
-     * @param index    
+     * @param index    get_tags()
      */
     void remove_tag(size_t index) {
-        if (index < tags_.size()) {
-            tags_.erase(tags_.begin() + index);
+        for (TagMask rest = tags_; rest != 0; rest &= rest - 1, --index) {
+            if (index == 0) {
+                tags_ &= ~(TagMask(1) << TagCatalogue::lowest(rest));
+                return;
+            }
         }
     }
     /// @}
 
 private:
 
-    std::vector<std::string> tags_; ///<  
+    /**
+     * @brief    
+     * @param id_  ID
+     * @param amt    
+     * @param t  
+     * @param d  
+     * @param cat 
+     * @param desc 
+     * @param currency  
+     *
+     * @note        ID 
+     *      -  
+     */
+    Transaction(TransactionId id_, std::int64_t amt, Type t, const Date& d, Symbol cat,
+        std::string desc, Symbol currency)
+        : id(id_), amount(amt), category(cat), type(t), date(d),
+        description(std::move(desc)), currency_(currency) {
+    }
+
+    /**
+     * @brief    (  )
+     */
+    static Symbol default_currency() {
+        static const Symbol rub("RUB");
+        return rub;
+    }
+
+    TagMask tags_ = 0; ///< :    
     static constexpr size_t MAX_TAGS = 5; ///<   
 
-    static inline int next_id = 1; ///<    ID
-    int id;             ///<  
-    double amount;      ///<   (> 0)
-    std::string category; ///<  
+    static inline IdAllocator id_allocator; ///<  ID (   )
+    TransactionId id;   ///<  
+    std::int64_t amount; ///<      (> 0)
+    Symbol category;    ///<  
     Type type;          ///<  (/)
     Date date;          ///<  
     std::string description; ///<  ()
-    std::string currency_ = "RUB"; ///<   (ISO 4217)
+    Symbol currency_ = default_currency(); ///<   (ISO 4217)
 
     /**
      * @brief   
@@ -0,0 +1,139 @@
+/**
+ * @file TransactionQuery.cpp
+ * @brief     
+ */
+
+#include "TransactionQuery.hpp"
+
+TransactionQuery& TransactionQuery::type(Transaction::Type t) {
+    type_ = t;
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::between(const Date& from, const Date& to) {
+    from_ = from;
+    to_ = to;
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::currency(std::string_view code) {
+    currency_ = Symbol(code);
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::category(std::string_view name) {
+    category_ = Symbol(name);
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::any_tag(TagMask mask) {
+    any_tag_ = mask;
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::any_tag(const std::vector<std::string>& tags) {
+    TagMask mask = 0;
+    for (const auto& tag : tags) {
+        const int bit = TagCatalogue::find(tag);
+        if (bit >= 0) mask |= TagMask(1) << bit;
+    }
+    return any_tag(mask);
+}
+
+TransactionQuery& TransactionQuery::all_tags(TagMask mask) {
+    all_tags_ = mask;
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::min_amount(Money amount) {
+    min_amount_ = amount.minor_units();
+    return *this;
+}
+
+TransactionQuery& TransactionQuery::max_amount(Money amount) {
+    max_amount_ = amount.minor_units();
+    return *this;
+}
+
+bool TransactionQuery::matches(const TransactionStore::Row& row) const {
+    const std::int64_t amount = row.get_amount().minor_units();
+    return (!type_ || row.get_type() == *type_)
+        && (!from_ || !(row.get_date() < *from_))
+        && (!to_ || !(*to_ < row.get_date()))
+        && (!currency_ || row.get_currency_symbol() == *currency_)
+        && (!category_ || row.get_category_symbol() == *category_)
+        && (!any_tag_ || (row.get_tag_mask() & *any_tag_) != 0)
+        && (row.get_tag_mask() & all_tags_) == all_tags_
+        && (!min_amount_ || amount >= *min_amount_)
+        && (!max_amount_ || amount <= *max_amount_);
+}
+
+template <typename Keep>
+void TransactionQuery::narrow(std::optional<std::vector<std::uint32_t>>& rows, size_t size, Keep keep) {
+    if (!rows) {
+        rows.emplace();
+        for (size_t row = 0; row < size; ++row) {
+            if (keep(row)) rows->push_back(static_cast<std::uint32_t>(row));
+        }
+        return;
+    }
+    size_t kept = 0;
+    for (std::uint32_t row : *rows) {
+        if (keep(row)) (*rows)[kept++] = row;
+    }
+    rows->resize(kept);
+}
+
+TransactionSelection TransactionQuery::select(std::shared_ptr<const TransactionStore> store) const {
+    if (!store) return {};
+    const TransactionStore& s = *store;
+    const size_t n = s.size();
+
+    //    :    
+    std::optional<std::vector<std::uint32_t>> rows;
+    if (category_) {
+        const auto& column = s.categories();
+        narrow(rows, n, [&](size_t row) { return column[row] == *category_; });
+    }
+    if (any_tag_ || all_tags_ != 0) {
+        const auto& column = s.tag_masks();
+        const TagMask any = any_tag_.value_or(~TagMask(0));
+        narrow(rows, n, [&](size_t row) {
+            return (column[row] & any) != 0 && (column[row] & all_tags_) == all_tags_;
+            });
+    }
+    if (from_ || to_) {
+        const auto& column = s.dates();
+        narrow(rows, n, [&](size_t row) {
+            return (!from_ || !(column[row] < *from_)) && (!to_ || !(*to_ < column[row]));
+            });
+    }
+    if (currency_) {
+        const auto& column = s.currencies();
+        narrow(rows, n, [&](size_t row) { return column[row] == *currency_; });
+    }
+    if (min_amount_ || max_amount_) {
+        const auto& column = s.amounts();
+        const std::int64_t low = min_amount_.value_or(std::numeric_limits<std::int64_t>::min());
+        const std::int64_t high = max_amount_.value_or(std::numeric_limits<std::int64_t>::max());
+        narrow(rows, n, [&](size_t row) { return column[row] >= low && column[row] <= high; });
+    }
+    if (type_) {
+        const auto& column = s.types();
+        narrow(rows, n, [&](size_t row) { return column[row] == *type_; });
+    }
+    if (!rows) {
+        rows.emplace(n);
+        for (size_t row = 0; row < n; ++row) (*rows)[row] = static_cast<std::uint32_t>(row);
+    }
+    rows->shrink_to_fit();
+    return TransactionSelection(std::move(store), std::move(*rows));
+}
+
+size_t TransactionQuery::count(const TransactionStore& store) const {
+    size_t found = 0;
+    for (const auto row : store) {
+        if (matches(row)) ++found;
+    }
+    return found;
+}
@@ -0,0 +1,160 @@
+/**
+ * @file TransactionQuery.hpp
+ * @brief    
+ *
+ * @details  (TransactionQuery)   , 
+ *   "": , , , , , 
+ * .  (TransactionSelection) -   
+ * (4    )    
+ *  .      
+ * TransactionStore::Row.
+ *
+ * @par :
+ * @code
+ * TransactionQuery query;
+ * query.type(Transaction::Type::EXPENSE).between(Date(2024, 1, 1), Date(2024, 3, 31)).currency("USD");
+ * TransactionSelection found = query.select(account.snapshot());
+ * for (const auto& t : found) std::cout << t.get_id() << "\n";
+ * @endcode
+ */
+
+#pragma once
+#include "TransactionStore.hpp"
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+ /**
+  * @class TransactionSelection
+  * @brief    
+  *
+  * @details   ( ),   
+  * ,      
+  */
+class TransactionSelection {
+public:
+    /**
+     * @class const_iterator
+     * @brief    
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = TransactionStore::Row;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = TransactionStore::Row;
+
+        const_iterator(const TransactionStore* store, const std::uint32_t* row) : store_(store), row_(row) {}
+
+        TransactionStore::Row operator*() const { return (*store_)[*row_]; }
+        const_iterator& operator++() { ++row_; return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; ++row_; return old; }
+        bool operator==(const const_iterator& other) const { return row_ == other.row_; }
+        bool operator!=(const const_iterator& other) const { return row_ != other.row_; }
+
+    private:
+        const TransactionStore* store_; ///< 
+        const std::uint32_t* row_;      ///<   
+    };
+
+    TransactionSelection() = default;
+
+    /**
+     * @param store ,    
+     * @param rows       ( 
+     *  TransactionQuery,    Account::transactions_between)
+     */
+    TransactionSelection(std::shared_ptr<const TransactionStore> store, std::vector<std::uint32_t> rows)
+        : store_(std::move(store)), rows_(std::move(rows)) {}
+
+    size_t size() const { return rows_.size(); }    ///<   
+    bool empty() const { return rows_.empty(); }    ///<   
+    TransactionStore::Row operator[](size_t i) const { return (*store_)[rows_[i]]; } ///< i-  
+    const_iterator begin() const { return const_iterator(store_.get(), rows_.data()); }               ///<  
+    const_iterator end() const { return const_iterator(store_.get(), rows_.data() + rows_.size()); } ///<  
+
+    const std::vector<std::uint32_t>& rows() const { return rows_; } ///<    
+    const TransactionStore* store() const { return store_.get(); }  ///<  (nullptr   )
+
+private:
+    std::shared_ptr<const TransactionStore> store_; ///<  
+    std::vector<std::uint32_t> rows_;               ///<   
+};
+
+ /**
+  * @class TransactionQuery
+  * @brief    
+  *
+  * @details -      
+  * .      .
+  *      
+  *
+  *     :    
+  *      ,   
+  *  .       
+  */
+class TransactionQuery {
+public:
+    /// @name 
+    /// @{
+    TransactionQuery& type(Transaction::Type t);              ///<     
+    TransactionQuery& between(const Date& from, const Date& to); ///<   [from, to]
+    TransactionQuery& currency(std::string_view code);        ///<  
+    TransactionQuery& category(std::string_view name);        ///<  
+    TransactionQuery& any_tag(TagMask mask);                  ///<       mask
+    TransactionQuery& all_tags(TagMask mask);                 ///<     mask
+    TransactionQuery& min_amount(Money amount);               ///<    amount (   )
+    TransactionQuery& max_amount(Money amount);               ///<    amount (   )
+
+    /**
+     * @brief      
+     * @param tags  ;   
+     * @note      ,    
+     */
+    TransactionQuery& any_tag(const std::vector<std::string>& tags);
+    /// @}
+
+    /**
+     * @brief   
+     * @param row  
+     */
+    bool matches(const TransactionStore::Row& row) const;
+
+    /**
+     * @brief    
+     * @param store   (Account::snapshot())
+     * @return     
+     * @complexity O(n)   ,  O()  
+     */
+    TransactionSelection select(std::shared_ptr<const TransactionStore> store) const;
+
+    /**
+     * @brief      
+     */
+    size_t count(const TransactionStore& store) const;
+
+private:
+    /**
+     * @brief     
+     * @param rows [in,out]   ( optional -  )
+     * @param size   
+     * @param keep    
+     */
+    template <typename Keep>
+    static void narrow(std::optional<std::vector<std::uint32_t>>& rows, size_t size, Keep keep);
+
+    std::optional<Transaction::Type> type_;   ///<  
+    std::optional<Date> from_;                ///<  
+    std::optional<Date> to_;                  ///<  
+    std::optional<Symbol> currency_;          ///< 
+    std::optional<Symbol> category_;          ///< 
+    std::optional<TagMask> any_tag_;          ///<     
+    TagMask all_tags_ = 0;                    ///<   
+    std::optional<std::int64_t> min_amount_;  ///<    ( )
+    std::optional<std::int64_t> max_amount_;  ///<    ( )
+};
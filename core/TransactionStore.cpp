@@ -0,0 +1,152 @@
+/**
+ * @file TransactionStore.cpp
+ * @brief    
+ */
+
+#include "TransactionStore.hpp"
+#include <algorithm>
+
+namespace {
+
+    /**
+     * @brief   other    column
+     */
+    template <typename T>
+    void append_column(std::vector<T>& column, const std::vector<T>& other) {
+        column.insert(column.end(), other.begin(), other.end());
+    }
+
+} // namespace
+
+TransactionStore::TransactionStore(const TransactionStore& other)
+    : amounts_(other.amounts_), types_(other.types_), dates_(other.dates_),
+    currencies_(other.currencies_), tags_(other.tags_), ids_(other.ids_),
+    categories_(other.categories_) {
+    descriptions_.reserve(other.descriptions_.size());
+    for (std::string_view s : other.descriptions_) descriptions_.push_back(text_.store(s));
+}
+
+TransactionStore& TransactionStore::operator=(const TransactionStore& other) {
+    if (this != &other) *this = TransactionStore(other);
+    return *this;
+}
+
+TransactionStore::TransactionStore(const std::vector<Transaction>& rows) {
+    reserve(rows.size());
+    for (const auto& t : rows) push_back(t);
+}
+
+Transaction TransactionStore::materialize(size_t index) const {
+    Transaction t(ids_[index], amounts_[index], types_[index], dates_[index],
+        categories_[index], std::string(descriptions_[index]), currencies_[index]);
+    t.tags_ = tags_[index];
+    return t;
+}
+
+size_t TransactionStore::find(TransactionId id) const {
+    auto it = std::find(ids_.begin(), ids_.end(), id);
+    return it == ids_.end() ? npos : static_cast<size_t>(it - ids_.begin());
+}
+
+void TransactionStore::reserve(size_t n) {
+    amounts_.reserve(n);
+    types_.reserve(n);
+    dates_.reserve(n);
+    currencies_.reserve(n);
+    tags_.reserve(n);
+    ids_.reserve(n);
+    categories_.reserve(n);
+    descriptions_.reserve(n);
+}
+
+void TransactionStore::emplace_back(TransactionId id, std::int64_t amount, Transaction::Type type, Date date,
+    Symbol category, std::string_view description, Symbol currency, TagMask tags) {
+    amounts_.push_back(amount);
+    types_.push_back(type);
+    dates_.push_back(date);
+    currencies_.push_back(currency);
+    tags_.push_back(tags);
+    ids_.push_back(id);
+    categories_.push_back(category);
+    descriptions_.push_back(text_.store(description));
+}
+
+void TransactionStore::push_back(const Transaction& t) {
+    emplace_back(t.id, t.amount, t.type, t.date, t.category, t.description, t.currency_, t.tags_);
+}
+
+void TransactionStore::erase(size_t index) {
+    amounts_.erase(amounts_.begin() + index);
+    types_.erase(types_.begin() + index);
+    dates_.erase(dates_.begin() + index);
+    currencies_.erase(currencies_.begin() + index);
+    tags_.erase(tags_.begin() + index);
+    ids_.erase(ids_.begin() + index);
+    categories_.erase(categories_.begin() + index);
+    descriptions_.erase(descriptions_.begin() + index);
+}
+
+void TransactionStore::append(const TransactionStore& other) {
+    append_column(amounts_, other.amounts_);
+    append_column(types_, other.types_);
+    append_column(dates_, other.dates_);
+    append_column(currencies_, other.currencies_);
+    append_column(tags_, other.tags_);
+    append_column(ids_, other.ids_);
+    append_column(categories_, other.categories_);
+    descriptions_.reserve(descriptions_.size() + other.descriptions_.size());
+    for (std::string_view s : other.descriptions_) descriptions_.push_back(text_.store(s));
+}
+
+void TransactionStore::append(TransactionStore&& other) {
+    if (empty()) {
+        *this = std::move(other);
+        other.clear();
+        return;
+    }
+    //   :   other    
+    append_column(amounts_, other.amounts_);
+    append_column(types_, other.types_);
+    append_column(dates_, other.dates_);
+    append_column(currencies_, other.currencies_);
+    append_column(tags_, other.tags_);
+    append_column(ids_, other.ids_);
+    append_column(categories_, other.categories_);
+    append_column(descriptions_, other.descriptions_);
+    text_.splice(std::move(other.text_));
+    other.clear();
+}
+
+void TransactionStore::clear() {
+    amounts_.clear();
+    types_.clear();
+    dates_.clear();
+    currencies_.clear();
+    tags_.clear();
+    ids_.clear();
+    categories_.clear();
+    descriptions_.clear();
+    text_.clear();
+}
+
+void TransactionStore::move_row(size_t from, size_t to) {
+    amounts_[to] = amounts_[from];
+    types_[to] = types_[from];
+    dates_[to] = dates_[from];
+    currencies_[to] = currencies_[from];
+    tags_[to] = tags_[from];
+    ids_[to] = ids_[from];
+    categories_[to] = categories_[from];
+    descriptions_[to] = descriptions_[from];
+}
+
+void TransactionStore::resize(size_t n) {
+    amounts_.erase(amounts_.begin() + n, amounts_.end());
+    types_.erase(types_.begin() + n, types_.end());
+    dates_.erase(dates_.begin() + n, dates_.end());
+    currencies_.erase(currencies_.begin() + n, currencies_.end());
+    tags_.erase(tags_.begin() + n, tags_.end());
+    ids_.erase(ids_.begin() + n, ids_.end());
+    categories_.erase(categories_.begin() + n, categories_.end());
+    descriptions_.erase(descriptions_.begin() + n, descriptions_.end());
+}
@@ -0,0 +1,225 @@
+/**
+ * @file TransactionStore.hpp
+ * @brief    
+ *
+ * @details       Transaction,
+ *       :
+ * -   (, , ): , , ,
+ *   ,   - 8 + 1 + 4 + 4 + 8   
+ * -   (, ): ID, , 
+ *
+ *       (TextArena):  
+ *   string_view,      
+ *      .
+ *
+ *   -        
+ * .     - Row   
+ * ,   Transaction,   
+ * `for (const auto& t : account.get_transactions())`  .
+ */
+
+#pragma once
+#include "TextArena.hpp"
+#include "Time_Manager.hpp"
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+ /**
+  * @class TransactionStore
+  * @brief     
+  *
+  * @invariant     
+  * @note  :   Account
+  */
+class TransactionStore {
+public:
+    /**
+     * @class Row
+     * @brief      Transaction
+     *
+     * @details   (  ): ,
+     *    .   Transaction 
+     */
+    class Row {
+    public:
+        Row(const TransactionStore& store, size_t index) : store_(&store), index_(index) {}
+
+        /// @name  (  Transaction)
+        /// @{
+        TransactionId get_id() const { return store_->ids_[index_]; }
+        Money get_amount() const { return Money(store_->amounts_[index_], store_->currencies_[index_]); }
+        Money get_signed_amount() const {
+            const std::int64_t amount = store_->amounts_[index_];
+            return Money(get_type() == Transaction::Type::INCOME ? amount : -amount, store_->currencies_[index_]);
+        }
+        std::string_view get_category() const { return store_->categories_[index_].view(); }
+        Symbol get_category_symbol() const { return store_->categories_[index_]; }
+        Transaction::Type get_type() const { return store_->types_[index_]; }
+        Date get_date() const { return store_->dates_[index_]; }
+        std::string_view get_description() const { return store_->descriptions_[index_]; }
+        std::string_view get_currency() const { return store_->currencies_[index_].view(); }
+        Symbol get_currency_symbol() const { return store_->currencies_[index_]; }
+        TagMask get_tag_mask() const { return store_->tags_[index_]; }
+        std::vector<std::string_view> get_tags() const { return TagCatalogue::names(store_->tags_[index_]); }
+        size_t tag_count() const { return TagCatalogue::count(store_->tags_[index_]); }
+        bool has_tag(std::string_view tag) const {
+            const int bit = TagCatalogue::find(tag);
+            return bit >= 0 && (store_->tags_[index_] >> bit & 1) != 0;
+        }
+        Money get_amount_in_rub(const CurrencyConverter& converter) const {
+            return converter.convert(get_amount(), "RUB");
+        }
+        /// @}
+
+        size_t index() const { return index_; } ///<    
+
+        /**
+         * @brief     
+         */
+        operator Transaction() const { return store_->materialize(index_); }
+
+    private:
+        const TransactionStore* store_; ///< 
+        size_t index_;                  ///<  
+    };
+
+    /**
+     * @class const_iterator
+     * @brief    (  Row  )
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Row;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Row;
+
+        const_iterator(const TransactionStore& store, size_t index) : store_(&store), index_(index) {}
+
+        Row operator*() const { return Row(*store_, index_); }
+        const_iterator& operator++() { ++index_; return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; ++index_; return old; }
+        bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const const_iterator& other) const { return index_ != other.index_; }
+
+    private:
+        const TransactionStore* store_; ///< 
+        size_t index_;                  ///<  
+    };
+
+    static constexpr size_t npos = static_cast<size_t>(-1); ///<  " "
+
+    TransactionStore() = default;
+    TransactionStore(TransactionStore&&) noexcept = default;
+    TransactionStore& operator=(TransactionStore&&) noexcept = default;
+
+    /**
+     * @brief  ,      
+     * @details      :   
+     */
+    TransactionStore(const TransactionStore& other);
+    TransactionStore& operator=(const TransactionStore& other);
+
+    /**
+     * @brief    
+     * @param rows 
+     */
+    explicit TransactionStore(const std::vector<Transaction>& rows);
+
+    /// @name 
+    /// @{
+    size_t size() const { return ids_.size(); }    ///<  
+    bool empty() const { return ids_.empty(); }    ///<   
+    Row operator[](size_t index) const { return Row(*this, index); } ///<   
+    const_iterator begin() const { return const_iterator(*this, 0); }      ///<  
+    const_iterator end() const { return const_iterator(*this, size()); }   ///<   
+
+    /**
+     * @brief     
+     * @param index  
+     */
+    Transaction materialize(size_t index) const;
+
+    /**
+     * @brief    ID
+     * @return    npos
+     * @complexity O(n)    ID
+     */
+    size_t find(TransactionId id) const;
+    /// @}
+
+    /// @name 
+    /// @{
+    void reserve(size_t n);                  ///<     
+    void push_back(const Transaction& t);    ///<  
+    void erase(size_t index);                ///<   ( )
+    void append(const TransactionStore& other); ///<    other
+    void append(TransactionStore&& other);   ///<   other,   
+    void clear();                            ///<      
+
+    /**
+     * @brief    ,   
+     * @param description  (  )
+     *
+     * @details  :    Transaction
+     *       
+     * @note     Transaction,   
+     */
+    void emplace_back(TransactionId id, std::int64_t amount, Transaction::Type type, Date date,
+        Symbol category, std::string_view description, Symbol currency, TagMask tags);
+
+    /**
+     * @brief  ,   drop(Row)  true
+     * @return   
+     * @details    ,  
+     */
+    template <typename Predicate>
+    size_t remove_if(Predicate drop) {
+        size_t kept = 0;
+        for (size_t row = 0; row < size(); ++row) {
+            if (drop(Row(*this, row))) continue;
+            if (kept != row) move_row(row, kept);
+            ++kept;
+        }
+        const size_t removed = size() - kept;
+        resize(kept);
+        return removed;
+    }
+    /// @}
+
+    const TextArena& text() const { return text_; } ///<   ( )
+
+    /// @name 
+    /// @details  :       
+    /// @{
+    const std::vector<std::int64_t>& amounts() const { return amounts_; }          ///<    
+    const std::vector<Transaction::Type>& types() const { return types_; }         ///<  
+    const std::vector<Date>& dates() const { return dates_; }                      ///< 
+    const std::vector<Symbol>& currencies() const { return currencies_; }          ///<  
+    const std::vector<TagMask>& tag_masks() const { return tags_; }                ///<  
+    const std::vector<TransactionId>& ids() const { return ids_; }                 ///< ID 
+    const std::vector<Symbol>& categories() const { return categories_; }          ///< 
+    const std::vector<std::string_view>& descriptions() const { return descriptions_; } ///<  (  )
+    /// @}
+
+private:
+    void move_row(size_t from, size_t to); ///<   from   to
+    void resize(size_t n);                 ///<     n  (n <= size())
+
+    //  
+    std::vector<std::int64_t> amounts_;         ///<     (> 0)
+    std::vector<Transaction::Type> types_;      ///<  
+    std::vector<Date> dates_;                   ///<  
+    std::vector<Symbol> currencies_;            ///<  
+    std::vector<TagMask> tags_;                 ///< 
+
+    //  
+    std::vector<TransactionId> ids_;            ///<  ID
+    std::vector<Symbol> categories_;            ///< 
+    std::vector<std::string_view> descriptions_; ///<  (  text_)
+
+    TextArena text_;                            ///<  
+};
@@ -20,9 +20,15 @@
  */
 
 #include "FinanceCore.hpp"
+#ifdef _WIN32
 #include <Windows.h>
+#endif
 #include <iomanip>
 
+namespace {
+    constexpr size_t HISTORY_PAGE = 256; ///<  ,     
+}
+
  /**
  * @brief      
  *
@@ -57,8 +63,10 @@
  */
 
 void FinanceCore::addTransaction() {
+#ifdef _WIN32
     SetConsoleOutputCP(CP_UTF8);
     SetConsoleCP(CP_UTF8);
+#endif
 
     Transaction newTrans;
     int step = 1;
@@ -176,13 +184,13 @@ void FinanceCore::addTransaction() {
                 while (!tag_adding_finished) {
                     clearConsole();
                     std::cout << "\n===   ("
-                        << newTrans.get_tags().size() << "/"
+                        << newTrans.tag_count() << "/"
                         << Transaction::MAX_TAGS << ") ===\n";
 
                     //   
-                    if (!newTrans.get_tags().empty()) {
+                    if (newTrans.tag_count() > 0) {
                         std::cout << " : ";
-                        for (size_t i = 0; i < newTrans.get_tags().size(); ++i) {
+                        for (size_t i = 0; i < newTrans.tag_count(); ++i) {
                             std::cout << (i > 0 ? ", " : "") << "[" << newTrans.get_tags()[i] << "]";
                         }
                         std::cout << "\n\n";
@@ -195,7 +203,7 @@ void FinanceCore::addTransaction() {
                     }
 
                     std::cout << "\n0.   \n";
-                    if (!newTrans.get_tags().empty()) {
+                    if (newTrans.tag_count() > 0) {
                         std::cout << "99.  \n";
                     }
                     std::cout << " : ";
@@ -206,16 +214,16 @@ void FinanceCore::addTransaction() {
                         tag_adding_finished = true;
                         step++;
                     }
-                    else if (choice == 99 && !newTrans.get_tags().empty()) {
+                    else if (choice == 99 && newTrans.tag_count() > 0) {
                         //  
                         std::cout << "   :\n";
-                        for (size_t i = 0; i < newTrans.get_tags().size(); ++i) {
+                        for (size_t i = 0; i < newTrans.tag_count(); ++i) {
                             std::cout << i + 1 << ". " << newTrans.get_tags()[i] << "\n";
                         }
                         std::cout << "0. \n> ";
 
                         int tag_choice = getMenuChoice();
-                        if (tag_choice > 0 && tag_choice <= newTrans.get_tags().size()) {
+                        if (tag_choice > 0 && tag_choice <= newTrans.tag_count()) {
                             newTrans.remove_tag(tag_choice - 1); //   
                         }
                     }
@@ -223,11 +231,10 @@ void FinanceCore::addTransaction() {
                         //  
                         try {
                             const std::string& selected_tag = available_tags[choice - 1];
-                            if (std::find(newTrans.get_tags().begin(), newTrans.get_tags().end(), selected_tag)
-                                != newTrans.get_tags().end()) {
+                            if (newTrans.has_tag(selected_tag)) {
                                 std::cout << "   !\n";
                             }
-                            else if (newTrans.get_tags().size() >= Transaction::MAX_TAGS) {
+                            else if (newTrans.tag_count() >= Transaction::MAX_TAGS) {
                                 std::cout << "   (" << Transaction::MAX_TAGS << ")\n";
                             }
                             else {
@@ -248,17 +255,15 @@ void FinanceCore::addTransaction() {
             case 7: { // 
                 currentAccount->addTransaction(newTrans);
 
-                double rubAmount = currency_converter_.convert(
-                    newTrans.get_amount(),
-                    newTrans.get_currency(),
-                    "RUB"
-                );
+                //        
+                currentAccount->recalculateBalance(currency_converter_);
+                const Money rubAmount = newTrans.get_amount_in_rub(currency_converter_);
 
                 std::cout << "\n !\n"
                     << ": " << newTrans.get_amount() << " " << newTrans.get_currency()
                     << " (?" << std::fixed << std::setprecision(2) << rubAmount << " RUB)\n";
 
-                if (!newTrans.get_tags().empty()) {
+                if (newTrans.tag_count() > 0) {
                     std::cout << ": ";
                     for (const auto& tag : newTrans.get_tags()) {
                         std::cout << "[" << tag << "] ";
@@ -297,8 +302,10 @@ void FinanceCore::addTransaction() {
  * @warning    
  */
 void FinanceCore::removeTransaction() {
+#ifdef _WIN32
     SetConsoleOutputCP(CP_UTF8);
     SetConsoleCP(CP_UTF8);
+#endif
 
     //std::lock_guard<std::mutex> lock(accounts_mutex_);
 
@@ -309,11 +316,12 @@ void FinanceCore::removeTransaction() {
 
     viewAllTransactions();
     std::cout << " ID    (0  ): ";
-    int id = getMenuChoice();
+    const TransactionId id = getTransactionId();
 
     if (id == 0) return;
 
     if (currentAccount->removeTransaction(id)) {
+        currentAccount->recalculateBalance(currency_converter_);
         std::cout << " .\n";
     }
     else {
@@ -325,7 +333,7 @@ void FinanceCore::removeTransaction() {
 /**
  * @brief    
  *
- * @param transactions    
+ * @param transactions   
  * @param title  
  *
  * @details  :
@@ -338,9 +346,9 @@ void FinanceCore::removeTransaction() {
  * -    
  * -     (  WinAPI)
  * -  UTF-8 
+ * -       ,  
  */
-
-void FinanceCore::printTransactionsTable(const std::vector<Transaction>& transactions, const std::string& title) const {
+void FinanceCore::printTransactionsTable(const TransactionSelection& transactions, const std::string& title) const {
     if (transactions.empty()) {
         std::cout << "\n  (" << title << ")  .\n";
         return;
@@ -350,7 +358,40 @@ void FinanceCore::printTransactionsTable(const std::vector<Transaction>& transac
     std::cout << "+------+------------+----------+------------+------------+--------------+\n";
     std::cout << "|  ID  |        |       |       |      |     |\n";
     std::cout << "+------+------------+----------+------------+------------+--------------+\n";
+    printTransactionRows(transactions);
+    std::cout << "+------+------------+----------+------------+------------+--------------+\n" << std::flush;
+}
 
+/**
+ * @brief      
+ *
+ * @param parts   
+ * @param title  
+ *
+ * @details  -   printTransactionsTable   ,
+ *     
+ */
+void FinanceCore::printTransactionsTable(const std::vector<TransactionSelection>& parts, const std::string& title) const {
+    size_t total = 0;
+    for (const auto& part : parts) total += part.size();
+    if (total == 0) {
+        std::cout << "\n  (" << title << ")  .\n";
+        return;
+    }
+
+    std::cout << "\n=== " << title << " (" << total << ") ===\n";
+    std::cout << "+------+------------+----------+------------+------------+--------------+\n";
+    std::cout << "|  ID  |        |       |       |      |     |\n";
+    std::cout << "+------+------------+----------+------------+------------+--------------+\n";
+    for (const auto& part : parts) printTransactionRows(part);
+    std::cout << "+------+------------+----------+------------+------------+--------------+\n" << std::flush;
+}
+
+/**
+ * @brief    
+ * @param transactions 
+ */
+void FinanceCore::printTransactionRows(const TransactionSelection& transactions) const {
     for (const auto& t : transactions) {
         std::cout << "| " << std::setw(4) << t.get_id() << " | "
             << t.get_date().to_string() << " | "
@@ -359,55 +400,45 @@ void FinanceCore::printTransactionsTable(const std::vector<Transaction>& transac
             << std::setw(10) << t.get_currency() << " | "
             << std::setw(12) << (t.get_category().empty() ? "-" : t.get_category().substr(0, 12)) << " |\n";
     }
-    std::cout << "+------+------------+----------+------------+------------+--------------+\n" << std::flush;
 }
 
 /**
  * @brief    
  *
- * @details   currentAccount   INCOME
+ * @details   currentAccount   INCOME
  *        printTransactionsTable()
  *
  * @see printTransactionsTable()
- * @see getFilteredTransactions()
+ * @see selectTransactions()
  */
 void FinanceCore::viewIncome() const {
-    auto incomes = getFilteredTransactions(Transaction::Type::INCOME);
-    printTransactionsTable(incomes, "");
+    printTransactionsTable(selectTransactions(TransactionQuery().type(Transaction::Type::INCOME)), "");
 }
 
 /**
  * @brief    
  *
- * @details   currentAccount   EXPENSE
+ * @details   currentAccount   EXPENSE
  *        printTransactionsTable()
  *
  * @see printTransactionsTable()
- * @see getFilteredTransactions()
+ * @see selectTransactions()
  */
 void FinanceCore::viewExpenses() const {
-    auto expenses = getFilteredTransactions(Transaction::Type::EXPENSE);
-    printTransactionsTable(expenses, "");
+    printTransactionsTable(selectTransactions(TransactionQuery().type(Transaction::Type::EXPENSE)), "");
 }
 
 /**
- * @brief    
+ * @brief    
  *
- * @param type   (INCOME/EXPENSE)
- * @return    
+ * @param query  
+ * @return      
  *
- * @note    ( )
+ * @note   :   4    
  * @complexity O(n),  n -  
  */
-
-std::vector<Transaction> FinanceCore::getFilteredTransactions(Transaction::Type type) const {
-    std::vector<Transaction> result;
-    for (const auto& t : currentAccount->get_transactions()) {
-        if (t.get_type() == type) {
-            result.push_back(t);
-        }
-    }
-    return result;
+TransactionSelection FinanceCore::selectTransactions(const TransactionQuery& query) const {
+    return query.select(currentAccount->snapshot());
 }
 
 /**
@@ -420,6 +451,10 @@ std::vector<Transaction> FinanceCore::getFilteredTransactions(Transaction::Type
  *
  * @post    
  * @note      ( "...")
+ *
+ *    :    
+ *    (Account::history_page),    
+ *     
  */
 void FinanceCore::viewAllTransactions() const {
     clearConsole();
@@ -429,14 +464,18 @@ void FinanceCore::viewAllTransactions() const {
     std::cout << "|  ID  |        |       |       |      |     |      |\n";
     std::cout << "+------+------------+----------+------------+------------+--------------+--------------+\n";
 
-    for (const auto& t : currentAccount->get_transactions()) {
-        std::cout << "| " << std::setw(4) << t.get_id() << " | "
-            << t.get_date().to_string() << " | "
-            << std::setw(8) << (t.get_type() == Transaction::Type::INCOME ? "" : "") << " | "
-            << std::setw(10) << std::fixed << std::setprecision(2) << t.get_amount() << " | "
-            << std::setw(10) << t.get_currency() << " | "
-            << std::setw(12) << (t.get_category().empty() ? "-" : t.get_category()) << " | "
-            << std::setw(12) << (t.get_description().empty() ? "-" : t.get_description()) << " |\n";
+    for (size_t offset = 0;; offset += HISTORY_PAGE) {
+        const TransactionSelection page = currentAccount->history_page(offset, HISTORY_PAGE);
+        for (const auto& t : page) {
+            std::cout << "| " << std::setw(4) << t.get_id() << " | "
+                << t.get_date().to_string() << " | "
+                << std::setw(8) << (t.get_type() == Transaction::Type::INCOME ? "" : "") << " | "
+                << std::setw(10) << std::fixed << std::setprecision(2) << t.get_amount() << " | "
+                << std::setw(10) << t.get_currency() << " | "
+                << std::setw(12) << (t.get_category().empty() ? "-" : t.get_category()) << " | "
+                << std::setw(12) << (t.get_description().empty() ? "-" : t.get_description()) << " |\n";
+        }
+        if (page.size() < HISTORY_PAGE) break;
     }
     std::cout << "+------+------------+----------+------------+------------+--------------+--------------+\n" << std::flush;
 }
@@ -454,15 +493,7 @@ void FinanceCore::viewAllTransactions() const {
  * @note     
  */
 const std::vector<std::string>& Transaction::get_available_tags() {
-    static const std::vector<std::string> TAGS = {
-        "", "", "",
-        "", "", "", "",
-        "", "", "", "",
-        "", "", "", "",
-        "", "", "",
-        "", "", "",
-        "", "", "",
-        "", "", ""
-    };
+    static const std::vector<std::string> TAGS(
+        TagCatalogue::BUILTIN.begin(), TagCatalogue::BUILTIN.end());
     return TAGS;
 }
\ No newline at end of file
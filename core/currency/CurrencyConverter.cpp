@@ -9,14 +9,17 @@
  * -    
  *
  * @section data_handling  
- *  unordered_map    ,
- *   -   ( "USD"),  -   .
- *      .
+ *      RateTable: unordered_map 
+ *   ( "USD")   ,  ID
+ *    -   Money.   
+ *   (RateHistory)    shared_ptr 
+ * ,     .
  */
 
 #include "CurrencyConverter.hpp"
 #include "CurrencyFetcher.hpp"
 #include <../libs/json.hpp>
+#include <cmath>
 #include <fstream>
 #include <filesystem>
 #include <iostream>
@@ -29,23 +32,97 @@
   * @details  :
   * 1.   CurrencyFetcher
   * 2.    
-  * 3.   :
-  *    -  
-  *    -    
-  *    -  callback  
-  * 4.      
+  * 3.       
+  *      callback  
+  * 4.      , callback  false
   *
   * @note ,     
   */
 void CurrencyConverter::update_rates(std::function<void(bool)> callback) {
     CurrencyFetcher fetcher;
     fetcher.fetch_rates([this, callback](const auto& new_rates) {
-        std::lock_guard<std::mutex> lock(rates_mutex_);
-        rates_ = new_rates;
+        if (!new_rates.empty()) {
+            publish(new_rates);
+            record_history();
+        }
         callback(!new_rates.empty());
         });
 }
 
+/**
+ * @brief   
+ * @param new_rates  ->   RUB
+ */
+RateDiff CurrencyConverter::set_rates(std::unordered_map<std::string, double> new_rates) {
+    return publish(std::move(new_rates));
+}
+
+/**
+ * @brief     
+ * @param currency_code  
+ * @param relative  
+ */
+void CurrencyConverter::set_tolerance(std::string_view currency_code, double relative) {
+    if (!std::isfinite(relative) || relative < 0.0) throw std::invalid_argument("  ");
+    std::lock_guard<std::mutex> lock(publish_mutex_);
+    tolerances_[std::string(currency_code)] = relative;
+}
+
+/**
+ * @brief   
+ */
+std::shared_ptr<const RateTable> CurrencyConverter::rates() const {
+    static const auto empty = std::make_shared<const RateTable>();
+    auto table = std::atomic_load_explicit(&current_, std::memory_order_acquire);
+    return table ? table : empty;
+}
+
+/**
+ * @brief        
+ * @param rates  ->   RUB
+ * @return    
+ *
+ * @details ,  ID   -  
+ *   (     );
+ *    .     
+ * .  - release- : , 
+ *  ,     
+ */
+RateDiff CurrencyConverter::publish(std::unordered_map<std::string, double> rates) {
+    std::lock_guard<std::mutex> lock(publish_mutex_);
+    const auto previous = std::atomic_load_explicit(&current_, std::memory_order_relaxed);
+
+    RateDiff diff;
+    diff.from_version = previous ? previous->version() : 0;
+    const std::unordered_map<std::string, double> none;
+    const auto& old_rates = previous ? previous->by_code() : none;
+    for (auto& [code, rate] : rates) {
+        auto old = old_rates.find(code);
+        if (old == old_rates.end()) {
+            diff.changed.emplace_back(code);
+            continue;
+        }
+        if (rate == old->second) continue;
+        auto tolerance = tolerances_.find(code);
+        const double relative = tolerance != tolerances_.end() ? tolerance->second : DEFAULT_TOLERANCE;
+        if (std::abs(rate - old->second) <= relative * std::abs(old->second)) rate = old->second;
+        else diff.changed.emplace_back(code);
+    }
+    for (const auto& [code, rate] : old_rates) {
+        if (rates.count(code) == 0) diff.changed.emplace_back(code);
+    }
+
+    diff.to_version = diff.from_version;
+    if (previous && diff.empty()) return diff;
+    std::sort(diff.changed.begin(), diff.changed.end(),
+        [](Symbol a, Symbol b) { return a.view() < b.view(); });
+
+    auto table = std::make_shared<const RateTable>(std::move(rates), diff.from_version + 1);
+    diff.to_version = table->version();
+    std::atomic_store_explicit(&current_, std::move(table), std::memory_order_release);
+    return diff;
+}
+
 /**
  * @brief    
  * @param amount   
@@ -62,13 +139,157 @@ void CurrencyConverter::update_rates(std::function<void(bool)> callback) {
  *
  * @note ,     
  */
-double CurrencyConverter::convert(double amount, const std::string& from, const std::string& to) const {
-    std::lock_guard<std::mutex> lock(rates_mutex_);
-
+double CurrencyConverter::convert(double amount, std::string_view from, std::string_view to) const {
     if (from == to) return amount;
-    if (rates_.empty()) throw std::runtime_error(" ");
 
-    return amount * rates_.at(from) / rates_.at(to);
+    //       -    
+    const std::string from_code(from);
+    const std::string to_code(to);
+    const auto current = rates();
+    const RateTable& table = *current;
+    if (table.empty()) throw std::runtime_error("   ");
+
+    return amount * table.by_code().at(from_code) / table.by_code().at(to_code);
+}
+
+/**
+ * @brief   
+ * @param amount    
+ * @param to   
+ * @return    
+ *
+ * @details       ,
+ *     - " -  "
+ */
+Money CurrencyConverter::convert(Money amount, std::string_view to) const {
+    return convert(amount, Symbol(to));
+}
+
+/**
+ * @brief     -
+ * @param amount    
+ * @param target  
+ *
+ * @details    -   
+ */
+Money CurrencyConverter::convert(Money amount, Symbol target) const {
+    if (amount.currency() == target || amount.currency().empty()) {
+        return Money(amount.minor_units(), target);
+    }
+
+    const auto current = rates();
+    const RateTable& table = *current;
+    if (table.empty()) throw std::runtime_error("   ");
+
+    const std::uint16_t from = table.id(amount.currency());
+    const std::uint16_t to = table.id(target);
+    if (from == RateTable::NONE || to == RateTable::NONE) {
+        throw std::out_of_range("   " + std::string(from == RateTable::NONE ? amount.currency().view() : target.view()));
+    }
+    const double minor = static_cast<double>(amount.minor_units()) * table.cross(from, to);
+    return Money(Money::round_minor(minor), target);
+}
+
+namespace {
+
+    /**
+     * @brief    ,   , 
+     * @param historic    (0.0 -  )
+     */
+    double rate_or_current(double historic, const RateTable& table, Symbol currency) {
+        if (historic > 0.0) return historic;
+        if (table.empty()) throw std::runtime_error("   ");
+        const std::uint16_t id = table.id(currency);
+        if (id == RateTable::NONE) throw std::out_of_range("   " + std::string(currency.view()));
+        return table.rate(id);
+    }
+
+} // namespace
+
+/**
+ * @brief       
+ * @param amount    
+ * @param target  
+ * @param day  
+ *
+ * @details          
+ */
+Money CurrencyConverter::convert(Money amount, Symbol target, const Date& day) const {
+    if (amount.currency() == target || amount.currency().empty()) {
+        return Money(amount.minor_units(), target);
+    }
+
+    const auto past = history();
+    const auto current = rates();
+    const RateTable& table = *current;
+    const double from = rate_or_current(past->rate_at(amount.currency(), day), table, amount.currency());
+    const double to = rate_or_current(past->rate_at(target, day), table, target);
+    const double minor = static_cast<double>(amount.minor_units()) * from / to;
+    return Money(Money::round_minor(minor), target);
+}
+
+/**
+ * @brief       
+ *
+ * @details          ,
+ *       
+ */
+void CurrencyConverter::convert(const std::int64_t* amounts, const Symbol* currencies, const Date* dates,
+    size_t count, Symbol target, double* out) const {
+    const auto past = history();
+    const auto current = rates();
+    const RateTable& table = *current;
+    RateHistory::Sweep sweep(*past);
+
+    for (size_t i = 0; i < count; ++i) {
+        if (currencies[i] == target || currencies[i].empty()) {
+            out[i] = static_cast<double>(amounts[i]);
+            continue;
+        }
+        const double from = rate_or_current(sweep.rate(currencies[i], dates[i]), table, currencies[i]);
+        const double to = rate_or_current(sweep.rate(target, dates[i]), table, target);
+        out[i] = static_cast<double>(amounts[i]) * from / to;
+    }
+}
+
+/**
+ * @brief       
+ * @param amounts    
+ * @param target  
+ *
+ * @details     (  )  ;
+ *      RateTable::convert
+ */
+Money CurrencyConverter::convert_sum(const std::vector<Money>& amounts, Symbol target) const {
+    Money result(0, target);
+    std::vector<std::int64_t> minor;
+    std::vector<Symbol> currencies;
+    for (const Money& amount : amounts) {
+        if (amount.currency() == target || amount.currency().empty()) {
+            result += Money(amount.minor_units(), target);
+            continue;
+        }
+        minor.push_back(amount.minor_units());
+        currencies.push_back(amount.currency());
+    }
+    if (minor.empty()) return result;
+
+    const auto current = rates();
+    const RateTable& table = *current;
+    if (table.empty()) throw std::runtime_error("   ");
+
+    std::vector<std::uint16_t> ids(minor.size());
+    table.ids(currencies.data(), currencies.size(), ids.data());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        if (ids[i] == RateTable::NONE) throw std::out_of_range("   " + std::string(currencies[i].view()));
+    }
+    const std::uint16_t to = table.id(target);
+    if (to == RateTable::NONE) throw std::out_of_range("   " + std::string(target.view()));
+
+    std::vector<double> converted(minor.size());
+    table.convert(minor.data(), ids.data(), minor.size(), to, converted.data());
+    for (double value : converted) result += Money(Money::round_minor(value), target);
+    return result;
 }
 
 /**
@@ -82,12 +303,12 @@ double CurrencyConverter::convert(double amount, const std::string& from, const
  *   ...
  * }
  *
- * @note ,     
+ * @note ,   ,   
  */
-void CurrencyConverter::save_rates_to_file(const std::string& path) {
-    std::lock_guard<std::mutex> lock(rates_mutex_);
-    nlohmann::json j;
-    for (const auto& [code, rate] : rates_) {
+void CurrencyConverter::save_rates_to_file(const std::string& path) const {
+    nlohmann::json j = nlohmann::json::object();
+    const auto current = rates();
+    for (const auto& [code, rate] : current->by_code()) {
         j[code] = rate;
     }
 
@@ -106,10 +327,10 @@ void CurrencyConverter::save_rates_to_file(const std::string& path) {
  *         false,
  *      
  *
- * @note ,     
+ * @note :    , 
+ *   
  */
 bool CurrencyConverter::load_rates_from_file(const std::string& path) {
-    std::lock_guard<std::mutex> lock(rates_mutex_);
     std::ifstream file(path);
     if (!file) return false;
 
@@ -117,13 +338,89 @@ bool CurrencyConverter::load_rates_from_file(const std::string& path) {
         nlohmann::json j;
         file >> j;
 
-        rates_.clear();
+        std::unordered_map<std::string, double> rates;
         for (auto& [key, value] : j.items()) {
-            rates_[key] = value.get<double>();
+            rates[key] = value.get<double>();
         }
+        publish(std::move(rates));
         return true;
     }
     catch (...) {
         return false;
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief     
+ * @param day  
+ *
+ * @details       
+ * :     ,  
+ *      .    
+ *    
+ */
+void CurrencyConverter::record_history(const Date& day) {
+    std::lock_guard<std::mutex> lock(publish_mutex_);
+    const auto table = std::atomic_load_explicit(&current_, std::memory_order_relaxed);
+    if (!table || table->empty()) return;
+    const auto previous = std::atomic_load_explicit(&history_, std::memory_order_relaxed);
+    auto next = previous ? std::make_shared<RateHistory>(*previous) : std::make_shared<RateHistory>();
+    next->record(day, table->by_code());
+    publish_history(std::move(next));
+}
+
+/**
+ * @brief   
+ */
+std::shared_ptr<const RateHistory> CurrencyConverter::history() const {
+    static const auto empty = std::make_shared<const RateHistory>();
+    auto current = std::atomic_load_explicit(&history_, std::memory_order_acquire);
+    return current ? current : empty;
+}
+
+/**
+ * @brief   (release-,   publish)
+ *
+ * @details   ,    
+ * ;       
+ */
+void CurrencyConverter::publish_history(std::shared_ptr<const RateHistory> next) {
+    std::atomic_store_explicit(&history_, std::move(next), std::memory_order_release);
+}
+
+/**
+ * @brief   
+ * @param path   
+ *
+ * @note ,   ,   
+ */
+void CurrencyConverter::save_history_to_file(const std::string& path) const {
+    history()->save(path);
+}
+
+/**
+ * @brief   
+ * @param path   
+ * @return true   
+ *
+ * @details    ;    
+ *     ,   
+ */
+bool CurrencyConverter::load_history_from_file(const std::string& path) {
+    if (!std::filesystem::exists(path)) return false;
+    std::shared_ptr<RateHistory> loaded;
+    try {
+        loaded = std::make_shared<RateHistory>(RateHistory::load(path));
+    }
+    catch (const std::exception& e) {
+        std::cerr << "   : " << e.what() << "\n";
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(publish_mutex_);
+    if (const auto previous = std::atomic_load_explicit(&history_, std::memory_order_relaxed)) {
+        loaded->merge(*previous);
+    }
+    publish_history(std::move(loaded));
+    return true;
+}
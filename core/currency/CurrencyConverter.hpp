@@ -9,15 +9,76 @@
  * -   
  *
  * @section thread_safety 
- *       .
- *      .
+ *     (RateTable)  shared_ptr,
+ *   RCU:  (convert, is_currency_supported, save_rates_to_file)
+ *    std::atomic_load     .
+ *  (set_rates, load_rates_from_file, update_rates)  
+ *        (atomic_store).
+ * ,    ,    ;
+ *  ,     ,  
+ *     .    
+ *     .
+ *
+ * @section rate_diff  
+ *         
+ * RateDiff -  ,   ,   
+ *  .      (,
+ * set_tolerance)  :     . 
+ *     ,   ,  , 
+ *        RateDiff.  
+ *  ,    .
+ *
+ * @section history  
+ *     RateHistory    
+ *    (  ),   
+ *    .   
+ *   ,   .       
+ * (. RateHistory),        .
+ *       ,      -
+ *  .
+ *
+ * ,   ,     
+ * (get_amount_in_rub)    ;    -
+ *   convert(Money, Symbol, Date).   
+ *   :       
+ *  ,    .
  */
 
 #pragma once
+#include "../Money.hpp"
+#include "RateHistory.hpp"
+#include "RateTable.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <mutex>
 #include <functional>
+#include <stdexcept>
+#include <vector>
+
+ /**
+  * @struct RateDiff
+  * @brief   
+  */
+struct RateDiff {
+    std::uint64_t from_version = 0; ///<    (0 -   )
+    std::uint64_t to_version = 0;   ///<   ( from_version,    )
+    std::vector<Symbol> changed;    ///<   ,     ( )
+
+    bool empty() const { return changed.empty(); } ///<   
+
+    /**
+     * @brief   
+     * @param currency 
+     */
+    bool affects(Symbol currency) const {
+        return std::find(changed.begin(), changed.end(), currency) != changed.end();
+    }
+};
 
  /**
   * @class CurrencyConverter
@@ -30,6 +91,8 @@
 
 class CurrencyConverter {
 public:
+    static constexpr double DEFAULT_TOLERANCE = 0.0; ///<   :    
+
     /**
      * @brief    
      * @param callback   ,  bool ( )
@@ -49,27 +112,98 @@ public:
      * @throws std::runtime_error    
      * @throws std::out_of_range    
      */
-    double convert(double amount, const std::string& from, const std::string& to = "RUB") const;
+    double convert(double amount, std::string_view from, std::string_view to = "RUB") const;
+
+    /**
+     * @brief   
+     * @param amount    
+     * @param to   (  RUB)
+     * @return    ,    
+     *   " -  " (. Money.hpp)
+     *
+     * @throws std::runtime_error    
+     * @throws std::out_of_range    
+     */
+    Money convert(Money amount, std::string_view to = "RUB") const;
+
+    /**
+     * @brief     -
+     * @param amount    
+     * @param to  
+     *
+     * @details     Symbol   ,
+     *   .      
+     *    
+     *
+     * @throws std::runtime_error    
+     * @throws std::out_of_range    
+     */
+    Money convert(Money amount, Symbol to) const;
+
+    /**
+     * @brief       
+     * @param amount    
+     * @param to  
+     * @param day ,     (  )
+     *
+     * @details    -     
+     * (RateHistory::rate_at).     , 
+     *  
+     *
+     * @throws std::runtime_error    
+     * @throws std::out_of_range    
+     */
+    Money convert(Money amount, Symbol to, const Date& day) const;
+
+    /**
+     * @brief       
+     * @param amounts      
+     * @param currencies  
+     * @param dates  
+     * @param count  
+     * @param to  
+     * @param out [out]     to,  
+     *
+     * @details       (,
+     * Account::transactions_between):   
+     * RateHistory::Sweep,    ,  
+     *    .    
+     * ,  
+     *
+     * @throws std::runtime_error    
+     * @throws std::out_of_range    
+     */
+    void convert(const std::int64_t* amounts, const Symbol* currencies, const Date* dates,
+        size_t count, Symbol to, double* out) const;
 
     /**
      * @brief   
      * @param currency_code 3-   (ISO)
      * @return true     
      *
-     * @note   ,     
+     * @note ,   
      */
     bool is_currency_supported(const std::string& currency_code) const {
-        //std::lock_guard<std::mutex> lock(rates_mutex_);
-        return rates_.find(currency_code) != rates_.end();
+        return rates()->by_code().count(currency_code) != 0;
     }
 
+    /**
+     * @brief   
+     * @return    (,   ;  nullptr)
+     *
+     * @details  ,     ,   :
+     *           , 
+     *      
+     */
+    std::shared_ptr<const RateTable> rates() const;
+
     /**
      * @brief     
      * @param path     
      *
      * @details    JSON   (pretty print)
      */
-    void save_rates_to_file(const std::string& path);
+    void save_rates_to_file(const std::string& path) const;
 
     /**
      * @brief    
@@ -82,15 +216,93 @@ public:
      * @brief    
      * @param new_rates    ( ->   RUB)
      *
-     * @warning    !
-     *  production-  update_rates()
+     * @return ,    (. RateDiff)
+     *
+     * @details   :   
+     * ,   .     
+     *  
      */
-    void set_rates(const std::unordered_map<std::string, double>& new_rates) {
-        std::lock_guard<std::mutex> lock(rates_mutex_);
-        rates_ = new_rates;
-    }
+    RateDiff set_rates(std::unordered_map<std::string, double> new_rates);
+
+    /**
+     * @brief     
+     * @param currency_code  
+     * @param relative  :   , 
+     * | - | <= relative * 
+     *
+     * @details    .   
+     *   ,     
+     * @throws std::invalid_argument     
+     */
+    void set_tolerance(std::string_view currency_code, double relative);
+
+    /**
+     * @brief    
+     * @return 0,    ;    
+     */
+    std::uint64_t rates_version() const { return rates()->version(); }
+
+    /**
+     * @brief     
+     * @param day ,    
+     *
+     * @details    :   
+     *     ,    .  
+     *      ; update_rates 
+     *  .      
+     */
+    void record_history(const Date& day = Date());
+
+    /**
+     * @brief   
+     * @return  (,    ;  nullptr)
+     * @note  ,     ,   
+     */
+    std::shared_ptr<const RateHistory> history() const;
+
+    /**
+     * @brief      
+     * @param path   
+     * @throws std::runtime_error   
+     */
+    void save_history_to_file(const std::string& path) const;
+
+    /**
+     * @brief      
+     * @param path   
+     * @return true   ;     
+     */
+    bool load_history_from_file(const std::string& path);
+
+    /**
+     * @brief       
+     * @param amounts    
+     * @param to  
+     * @return  ;     
+     *
+     * @details     RateTable::convert   
+     * @throws std::runtime_error    
+     * @throws std::out_of_range    
+     */
+    Money convert_sum(const std::vector<Money>& amounts, Symbol to) const;
 
 private:
-    std::unordered_map<std::string, double> rates_; ///<    ( ->   RUB)
-    mutable std::mutex rates_mutex_; ///<      rates_
+    /**
+     * @brief    
+     * @param rates  (  )
+     * @return    
+     */
+    RateDiff publish(std::unordered_map<std::string, double> rates);
+
+    /**
+     * @brief    
+     * @param history 
+     * @pre  publish_mutex_
+     */
+    void publish_history(std::shared_ptr<const RateHistory> history);
+
+    std::shared_ptr<const RateTable> current_; ///<   (nullptr -   ;  std::atomic_load/atomic_store)
+    std::shared_ptr<const RateHistory> history_; ///<   (nullptr - ;  std::atomic_load/atomic_store)
+    std::unordered_map<std::string, double> tolerances_; ///<   ( publish_mutex_)
+    mutable std::mutex publish_mutex_; ///<  ;    
 };
\ No newline at end of file
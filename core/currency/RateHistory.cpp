@@ -0,0 +1,248 @@
+/**
+ * @file RateHistory.cpp
+ * @brief        
+ */
+
+#include "RateHistory.hpp"
+#include "../storage/BinaryCodec.hpp"
+#include "../storage/MappedFile.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+    constexpr char MAGIC[8] = { 'M', 'K', 'R', 'A', 'T', 'E', 'S', 0 }; ///<  
+    constexpr std::uint32_t FORMAT_VERSION = 1;                         ///<  
+    constexpr size_t POINT_SIZE = 4 + 8;                                ///<  i32 +  f64
+    constexpr std::int32_t FIRST_DAY = Date(Date::MIN_YEAR, 1, 1).day_number();  ///<   
+    constexpr std::int32_t LAST_DAY = Date(Date::MAX_YEAR, 12, 31).day_number(); ///<   
+
+} // namespace
+
+void RateHistory::record(const Date& day, const std::unordered_map<std::string, double>& rates) {
+    for (const auto& [code, rate] : rates) {
+        if (std::isfinite(rate) && rate > 0.0) record(Symbol(code), day, rate);
+    }
+}
+
+std::uint32_t RateHistory::add_series(Symbol currency) {
+    const auto index = static_cast<std::uint32_t>(series_.size());
+    if (currency.id() >= by_symbol_.size()) by_symbol_.resize(currency.id() + 1, NONE);
+    by_symbol_[currency.id()] = index;
+    series_.push_back(Series{ currency, {}, {}, 0 });
+    return index;
+}
+
+/**
+ * @details    (    
+ *  )    . ,  
+ * 2 * CHUNK_POINTS ,  
+ */
+void RateHistory::record(Symbol currency, const Date& day, double rate) {
+    std::uint32_t index = find(currency);
+    if (index == NONE) index = add_series(currency);
+
+    Series& series = series_[index];
+    const std::int32_t d = day.day_number();
+    if (series.chunks.empty() || series.chunks.back()->days.back() < d) {
+        if (series.chunks.empty() || series.chunks.back()->days.size() >= CHUNK_POINTS) {
+            series.chunks.push_back(std::make_shared<const Chunk>(Chunk{ { d }, { rate } }));
+            series.first_days.push_back(d);
+        }
+        else {
+            const Chunk& last = *series.chunks.back();
+            auto next = std::make_shared<Chunk>();
+            next->days.reserve(last.days.size() + 1);
+            next->rates.reserve(last.rates.size() + 1);
+            next->days = last.days;
+            next->rates = last.rates;
+            next->days.push_back(d);
+            next->rates.push_back(rate);
+            series.chunks.back() = std::move(next);
+        }
+        ++series.points;
+        return;
+    }
+
+    const size_t c = locate(series, d).chunk;
+    auto next = std::make_shared<Chunk>(*series.chunks[c]);
+    auto it = std::lower_bound(next->days.begin(), next->days.end(), d);
+    const auto pos = it - next->days.begin();
+    if (it != next->days.end() && *it == d) {
+        next->rates[pos] = rate;
+        series.chunks[c] = std::move(next);
+        return;
+    }
+    next->days.insert(it, d);
+    next->rates.insert(next->rates.begin() + pos, rate);
+    ++series.points;
+    series.first_days[c] = next->days.front();
+
+    if (next->days.size() > 2 * CHUNK_POINTS) {
+        const size_t half = next->days.size() / 2;
+        auto tail = std::make_shared<Chunk>();
+        tail->days.assign(next->days.begin() + half, next->days.end());
+        tail->rates.assign(next->rates.begin() + half, next->rates.end());
+        next->days.resize(half);
+        next->rates.resize(half);
+        series.first_days.insert(series.first_days.begin() + c + 1, tail->days.front());
+        series.chunks.insert(series.chunks.begin() + c + 1, std::move(tail));
+    }
+    series.chunks[c] = std::move(next);
+}
+
+void RateHistory::merge(const RateHistory& other) {
+    for (const Series& series : other.series_) {
+        for (const auto& chunk : series.chunks) {
+            for (size_t i = 0; i < chunk->days.size(); ++i) {
+                record(series.currency, Date::from_day_number(chunk->days[i]), chunk->rates[i]);
+            }
+        }
+    }
+}
+
+RateHistory::Position RateHistory::locate(const Series& series, std::int32_t day) {
+    auto first = std::upper_bound(series.first_days.begin(), series.first_days.end(), day);
+    if (first == series.first_days.begin()) return Position{};
+    const size_t c = static_cast<size_t>(first - series.first_days.begin()) - 1;
+    const Chunk& chunk = *series.chunks[c];
+    auto it = std::upper_bound(chunk.days.begin(), chunk.days.end(), day);
+    return Position{ c, static_cast<size_t>(it - chunk.days.begin()) - 1 };
+}
+
+double RateHistory::rate_at(Symbol currency, const Date& day) const {
+    const std::uint32_t index = find(currency);
+    if (index == NONE) return 0.0;
+    const Series& series = series_[index];
+    const Position at = locate(series, day.day_number());
+    return series.chunks[at.chunk]->rates[at.point];
+}
+
+size_t RateHistory::points() const {
+    size_t total = 0;
+    for (const Series& series : series_) total += series.points;
+    return total;
+}
+
+double RateHistory::Sweep::rate(Symbol currency, const Date& day) {
+    const std::uint32_t index = history_.find(currency);
+    if (index == NONE) return 0.0;
+    const Series& series = history_.series_[index];
+    const std::int32_t d = day.day_number();
+
+    Position& at = cursor_[index];
+    const Chunk* chunk = series.chunks[at.chunk].get();
+    if (chunk->days[at.point] > d) {
+        at = locate(series, d);
+        return series.chunks[at.chunk]->rates[at.point];
+    }
+    while (true) {
+        if (at.point + 1 < chunk->days.size()) {
+            if (chunk->days[at.point + 1] > d) break;
+            ++at.point;
+        }
+        else if (at.chunk + 1 < series.chunks.size() && series.first_days[at.chunk + 1] <= d) {
+            chunk = series.chunks[++at.chunk].get();
+            at.point = 0;
+        }
+        else {
+            break;
+        }
+    }
+    return chunk->rates[at.point];
+}
+
+/**
+ * @brief  
+ *
+ * @details : ,  u32,   u32,  
+ *     (),   u32  
+ * ( i32,  f64)
+ */
+void RateHistory::save(const std::string& path) const {
+    std::string buf;
+    buf.reserve(16 + points() * POINT_SIZE + series_.size() * 16);
+    ByteWriter out(buf);
+    out.raw(MAGIC, sizeof(MAGIC));
+    out.u32(FORMAT_VERSION);
+    out.u32(static_cast<std::uint32_t>(series_.size()));
+    for (const Series& series : series_) {
+        out.str(series.currency.view());
+        out.u32(static_cast<std::uint32_t>(series.points));
+        for (const auto& chunk : series.chunks) {
+            for (size_t i = 0; i < chunk->days.size(); ++i) {
+                out.u32(static_cast<std::uint32_t>(chunk->days[i]));
+                out.f64(chunk->rates[i]);
+            }
+        }
+    }
+
+    const std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) throw std::runtime_error("       ");
+        file.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+        file.close();
+        if (!file) throw std::runtime_error("    ");
+    }
+    std::filesystem::rename(tmp_path, path);
+}
+
+/**
+ * @brief  
+ *
+ * @details        ,  -
+ *  :    
+ */
+RateHistory RateHistory::load(const std::string& path) {
+    MappedFile file(path, MappedFile::Access::Sequential);
+    ByteReader in(file.view());
+
+    if (std::memcmp(in.take(sizeof(MAGIC)), MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("    ");
+    }
+    if (in.u32() != FORMAT_VERSION) {
+        throw std::runtime_error("   ");
+    }
+
+    RateHistory history;
+    const std::uint32_t series_count = in.u32();
+    for (std::uint32_t s = 0; s < series_count; ++s) {
+        const Symbol currency(in.str());
+        const std::uint32_t count = in.u32();
+        if (count == 0 || count > in.remaining() / POINT_SIZE || history.find(currency) != NONE) {
+            throw std::runtime_error("  :  ");
+        }
+
+        Series& series = history.series_[history.add_series(currency)];
+        std::shared_ptr<Chunk> chunk;
+        std::int32_t previous = FIRST_DAY - 1;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const auto day = static_cast<std::int32_t>(in.u32());
+            const double rate = in.f64();
+            if (day < FIRST_DAY || day > LAST_DAY || day <= previous || !std::isfinite(rate) || rate <= 0.0) {
+                throw std::runtime_error("  :  ");
+            }
+            previous = day;
+
+            if (!chunk) {
+                const size_t size = std::min<size_t>(CHUNK_POINTS, count - i);
+                chunk = std::make_shared<Chunk>();
+                chunk->days.reserve(size);
+                chunk->rates.reserve(size);
+                series.first_days.push_back(day);
+            }
+            chunk->days.push_back(day);
+            chunk->rates.push_back(rate);
+            if (chunk->days.size() == CHUNK_POINTS) series.chunks.push_back(std::move(chunk));
+        }
+        if (chunk) series.chunks.push_back(std::move(chunk));
+        series.points = count;
+    }
+    if (!in.at_end()) throw std::runtime_error("  :  ");
+    return history;
+}
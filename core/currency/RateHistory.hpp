@@ -0,0 +1,188 @@
+/**
+ * @file RateHistory.hpp
+ * @brief     
+ *
+ * @details         
+ * (,   RUB).      CHUNK_POINTS ,   -
+ *   .    -     
+ *  :      ,   ,
+ * O(log n).    ,   , 
+ * Sweep:      ,  
+ *  - O(k + n)  k  .
+ *
+ *         
+ * (shared_ptr).   O( + n / CHUNK_POINTS),   
+ *    :     
+ *     .
+ *
+ *       (CurrencyDat/rate_history.bin):
+ * , ,        
+ * ( i32,  f64).
+ *
+ * @par :
+ * @code
+ * RateHistory history = RateHistory::load("CurrencyDat/rate_history.bin");
+ * history.record(Date(), fetched_rates);
+ * double usd = history.rate_at(Symbol("USD"), Date(2024, 3, 1));
+ * @endcode
+ */
+
+#pragma once
+#include "../Date.hpp"
+#include "../StringPool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+ /**
+  * @class RateHistory
+  * @brief    RUB  
+  *
+  * @details  : CurrencyConverter  
+  *  .        
+  *  :    ,   
+  */
+class RateHistory {
+public:
+    static constexpr std::uint32_t NONE = 0xFFFFFFFF; ///<  " "
+    static constexpr size_t CHUNK_POINTS = 128;       ///<     (    -  2x)
+
+    /**
+     * @brief    
+     * @param day   
+     * @param rates   ->   RUB
+     *
+     * @details      .  
+     *    ,     
+     *   (   CHUNK_POINTS );  
+     *   
+     */
+    void record(const Date& day, const std::unordered_map<std::string, double>& rates);
+
+    /**
+     * @brief   
+     * @param currency 
+     * @param day 
+     * @param rate   RUB ()
+     */
+    void record(Symbol currency, const Date& day, double rate);
+
+    /**
+     * @brief    
+     * @param other ,      
+     */
+    void merge(const RateHistory& other);
+
+    /**
+     * @brief    
+     * @return      day;    
+     *  -    ; 0.0,   
+     * @complexity O(log n), n -   
+     */
+    double rate_at(Symbol currency, const Date& day) const;
+
+    bool empty() const { return series_.empty(); }     ///<  
+    size_t size() const { return series_.size(); }     ///<  
+    size_t points() const;                             ///<   
+
+    class Sweep; ///<      ( )
+
+    /**
+     * @brief     
+     * @param path   
+     * @throws std::runtime_error   
+     * @note       
+     */
+    void save(const std::string& path) const;
+
+    /**
+     * @brief     
+     * @param path   
+     * @throws std::runtime_error   ,   
+     */
+    static RateHistory load(const std::string& path);
+
+private:
+    /**
+     * @struct Chunk
+     * @brief    (  ,  )
+     * @note      :   
+     */
+    struct Chunk {
+        std::vector<std::int32_t> days; ///<   (Date::day_number)
+        std::vector<double> rates;      ///<   RUB  
+    };
+
+    /**
+     * @struct Series
+     * @brief   
+     */
+    struct Series {
+        Symbol currency;
+        std::vector<std::shared_ptr<const Chunk>> chunks; ///<     
+        std::vector<std::int32_t> first_days;             ///<    
+        size_t points = 0;                                ///<    
+    };
+
+    /**
+     * @struct Position
+     * @brief  :       
+     */
+    struct Position {
+        size_t chunk = 0;
+        size_t point = 0;
+    };
+
+    /**
+     * @brief  
+     * @return    NONE
+     */
+    std::uint32_t find(Symbol currency) const {
+        const std::uint32_t symbol = currency.id();
+        return symbol < by_symbol_.size() ? by_symbol_[symbol] : NONE;
+    }
+
+    /**
+     * @brief ,    day
+     * @pre   
+     */
+    static Position locate(const Series& series, std::int32_t day);
+
+    /**
+     * @brief   
+     * @return   
+     */
+    std::uint32_t add_series(Symbol currency);
+
+    std::vector<Series> series_;           ///<     
+    std::vector<std::uint32_t> by_symbol_; ///< Symbol::id() ->  
+};
+
+/**
+ * @brief     ,   
+ *
+ * @details      .  
+ *     ,   
+ *  O(1).     : 
+ *      
+ *
+ * @warning ,      
+ */
+class RateHistory::Sweep {
+public:
+    explicit Sweep(const RateHistory& history)
+        : history_(history), cursor_(history.series_.size()) {}
+
+    /**
+     * @brief     ( rate_at)
+     * @return   0.0,   
+     */
+    double rate(Symbol currency, const Date& day);
+
+private:
+    const RateHistory& history_;
+    std::vector<Position> cursor_; ///<  ->  
+};
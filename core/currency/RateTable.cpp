@@ -0,0 +1,60 @@
+/**
+ * @file RateTable.cpp
+ * @brief      
+ */
+
+#include "RateTable.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+RateTable::RateTable(std::unordered_map<std::string, double> rates, std::uint64_t version)
+    : rates_(std::move(rates)), version_(version) {
+    std::vector<const std::pair<const std::string, double>*> valid;
+    for (const auto& entry : rates_) {
+        if (std::isfinite(entry.second) && entry.second > 0.0) valid.push_back(&entry);
+    }
+    if (valid.size() >= NONE) throw std::length_error("  ");
+    std::sort(valid.begin(), valid.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+
+    codes_.reserve(valid.size());
+    to_rub_.reserve(valid.size());
+    for (const auto* entry : valid) {
+        const Symbol code(entry->first);
+        if (code.id() >= by_symbol_.size()) by_symbol_.resize(code.id() + 1, NONE);
+        by_symbol_[code.id()] = static_cast<std::uint16_t>(codes_.size());
+        codes_.push_back(code);
+        to_rub_.push_back(entry->second);
+    }
+
+    const size_t n = codes_.size();
+    cross_.resize(n * n);
+    for (size_t from = 0; from < n; ++from) {
+        for (size_t to = 0; to < n; ++to) {
+            cross_[from * n + to] = from == to ? 1.0 : to_rub_[from] / to_rub_[to];
+        }
+    }
+}
+
+void RateTable::ids(const Symbol* currencies, size_t count, std::uint16_t* out) const {
+    for (size_t i = 0; i < count; ++i) out[i] = id(currencies[i]);
+}
+
+void RateTable::convert(const std::int64_t* amounts, const std::uint16_t* from, size_t count,
+    std::uint16_t to, double* out) const {
+    if (to >= codes_.size()) throw std::out_of_range("   ");
+    const size_t n = codes_.size();
+    const double* column = cross_.data() + to;
+
+    size_t i = 0;
+    while (i < count) {
+        const std::uint16_t currency = from[i];
+        if (currency >= n) throw std::out_of_range("  ");
+        size_t end = i + 1;
+        while (end < count && from[end] == currency) ++end;
+
+        const double factor = column[static_cast<size_t>(currency) * n];
+        for (size_t k = i; k < end; ++k) out[k] = static_cast<double>(amounts[k]) * factor;
+        i = end;
+    }
+}
@@ -0,0 +1,112 @@
+/**
+ * @file RateTable.hpp
+ * @brief       ID   -
+ *
+ * @details       
+ * 16- ID (  ),    N x N:
+ * cross(from, to) = rate(from) / rate(to).   
+ *  ,    -    
+ *   ID    -.
+ *
+ * @par :
+ * @code
+ * const auto snapshot = converter.rates();
+ * const RateTable& rates = *snapshot;
+ * std::vector<std::uint16_t> ids(store.size());
+ * rates.ids(store.currencies().data(), store.size(), ids.data());
+ * std::vector<double> rub(store.size());
+ * rates.convert(store.amounts().data(), ids.data(), store.size(), rates.id(Symbol("RUB")), rub.data());
+ * @endcode
+ */
+
+#pragma once
+#include "../StringPool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+ /**
+  * @class RateTable
+  * @brief   
+  *
+  * @details     ,   
+  *    .  ID  
+  *   :       
+  */
+class RateTable {
+public:
+    static constexpr std::uint16_t NONE = 0xFFFF; ///<  " "
+
+    RateTable() = default; ///<   (  )
+
+    /**
+     * @brief  
+     * @param rates   ->   RUB
+     * @param version  
+     *
+     * @details       
+     *  by_code(),   ID  
+     * @throws std::length_error    65535
+     */
+    RateTable(std::unordered_map<std::string, double> rates, std::uint64_t version);
+
+    bool empty() const { return rates_.empty(); }          ///<   
+    size_t size() const { return codes_.size(); }          ///<     ID
+    std::uint64_t version() const { return version_; }     ///<  
+    const std::unordered_map<std::string, double>& by_code() const { return rates_; } ///<  ->   RUB
+
+    /**
+     * @brief  ID 
+     * @return ID  NONE
+     */
+    std::uint16_t id(Symbol currency) const {
+        const std::uint32_t symbol = currency.id();
+        return symbol < by_symbol_.size() ? by_symbol_[symbol] : NONE;
+    }
+
+    Symbol currency(std::uint16_t id) const { return codes_[id]; } ///<    ID
+    double rate(std::uint16_t id) const { return to_rub_[id]; }     ///<   RUB   ID
+
+    /**
+     * @brief -:   to    from
+     */
+    double cross(std::uint16_t from, std::uint16_t to) const { return cross_[static_cast<size_t>(from) * codes_.size() + to]; }
+
+    /**
+     * @brief      ID
+     * @param currencies  (count )
+     * @param count 
+     * @param out [out] ID (NONE    )
+     */
+    void ids(const Symbol* currencies, size_t count, std::uint16_t* out) const;
+
+    /**
+     * @brief  
+     * @param amounts      
+     * @param from  ID  
+     * @param count  
+     * @param to  ID  
+     * @param out [out]     to,  
+     *
+     * @details     : 
+     *       ,    - 
+     *    ,    
+     * gather-.  ,    
+     * ;        
+     *    
+     *
+     * @throws std::out_of_range   NONE
+     */
+    void convert(const std::int64_t* amounts, const std::uint16_t* from, size_t count,
+        std::uint16_t to, double* out) const;
+
+private:
+    std::unordered_map<std::string, double> rates_; ///<  ->   RUB
+    std::vector<Symbol> codes_;                     ///<  ID -> 
+    std::vector<double> to_rub_;                    ///<  ID ->   RUB
+    std::vector<std::uint16_t> by_symbol_;          ///< Symbol::id() ->  ID
+    std::vector<double> cross_;                     ///<  - ( - from)
+    std::uint64_t version_ = 0;                     ///<  
+};
@@ -0,0 +1,150 @@
+/**
+ * @file BinaryCodec.hpp
+ * @brief        
+ *
+ * @details    LedgerSnapshot  Journal:
+ * - ByteWriter:   little-endian  std::string
+ * - ByteReader:      
+ * - crc32:    
+ *
+ * @note    (little-endian)   
+ */
+
+#pragma once
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+ /**
+  * @class ByteWriter
+  * @brief     
+  */
+class ByteWriter {
+public:
+    explicit ByteWriter(std::string& out) : out_(out) {}
+
+    void u8(std::uint8_t v) { out_.push_back(static_cast<char>(v)); }
+
+    void u16(std::uint16_t v) {
+        out_.push_back(static_cast<char>(v & 0xFF));
+        out_.push_back(static_cast<char>(v >> 8));
+    }
+
+    void u32(std::uint32_t v) {
+        for (int i = 0; i < 4; ++i) out_.push_back(static_cast<char>((v >> (8 * i)) & 0xFF));
+    }
+
+    void u64(std::uint64_t v) {
+        for (int i = 0; i < 8; ++i) out_.push_back(static_cast<char>((v >> (8 * i)) & 0xFF));
+    }
+
+    void f64(double v) {
+        std::uint64_t bits;
+        static_assert(sizeof(bits) == sizeof(v), "double must be 64-bit");
+        std::memcpy(&bits, &v, sizeof(bits));
+        u64(bits);
+    }
+
+    ///     u32
+    void str(std::string_view s) {
+        u32(static_cast<std::uint32_t>(s.size()));
+        out_.append(s.data(), s.size());
+    }
+
+    void raw(const void* data, size_t size) { out_.append(static_cast<const char*>(data), size); }
+
+private:
+    std::string& out_;
+};
+
+/**
+ * @class ByteReader
+ * @brief      
+ *
+ * @throws std::runtime_error     
+ */
+class ByteReader {
+public:
+    explicit ByteReader(std::string_view data) : data_(data) {}
+
+    /**
+     * @brief   n 
+     * @return    
+     */
+    const unsigned char* take(size_t n) {
+        if (n > data_.size() - pos_) throw std::runtime_error("  ");
+        const auto* p = reinterpret_cast<const unsigned char*>(data_.data() + pos_);
+        pos_ += n;
+        return p;
+    }
+
+    std::uint8_t u8() { return *take(1); }
+    std::uint16_t u16() { return load_u16(take(2)); }
+    std::uint32_t u32() { return load_u32(take(4)); }
+    std::uint64_t u64() { return load_u64(take(8)); }
+
+    double f64() {
+        std::uint64_t bits = u64();
+        double v;
+        std::memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+
+    ///     u32 ( )
+    std::string_view str() {
+        std::uint32_t len = u32();
+        return { reinterpret_cast<const char*>(take(len)), len };
+    }
+
+    size_t position() const { return pos_; }          ///<  
+    size_t remaining() const { return data_.size() - pos_; } ///<  
+    bool at_end() const { return pos_ == data_.size(); }     ///<   
+
+    /// @name   
+    /// @{
+    static std::uint16_t load_u16(const unsigned char* p) {
+        return static_cast<std::uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    static std::uint32_t load_u32(const unsigned char* p) {
+        return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+            (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+    }
+
+    static std::uint64_t load_u64(const unsigned char* p) {
+        return static_cast<std::uint64_t>(load_u32(p)) | (static_cast<std::uint64_t>(load_u32(p + 4)) << 32);
+    }
+    /// @}
+
+private:
+    std::string_view data_;
+    size_t pos_ = 0;
+};
+
+/**
+ * @brief CRC-32 ( 0xEDB88320)
+ * @param data 
+ * @param size   
+ * @return  
+ */
+inline std::uint32_t crc32(const void* data, size_t size) {
+    static const auto table = [] {
+        std::array<std::uint32_t, 256> t{};
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            std::uint32_t c = i;
+            for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            t[i] = c;
+        }
+        return t;
+    }();
+
+    std::uint32_t crc = 0xFFFFFFFFu;
+    const auto* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        crc = table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
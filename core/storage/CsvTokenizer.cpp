@@ -0,0 +1,416 @@
+/**
+ * @file CsvTokenizer.cpp
+ * @brief   CSV     
+ *
+ * @details   ,       
+ *  ,    .   
+ *  (5-15 ),      
+ *  :    64    
+ *   ,       (ctz).
+ * AVX2    ,    ;
+ * SSE2    x86-64.
+ */
+
+#include "CsvTokenizer.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MONEY_KEEPER_HAS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(MONEY_KEEPER_HAS_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define MONEY_KEEPER_AVX2_DISPATCH 1
+#include <immintrin.h>
+#elif defined(__AVX2__)
+#define MONEY_KEEPER_AVX2_STATIC 1
+#include <immintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace {
+
+    ///     (mask != 0)
+    inline unsigned lowest_bit(unsigned mask) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+    }
+
+    ///     64-  (mask != 0)
+    inline unsigned lowest_bit64(std::uint64_t mask) {
+#if defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return static_cast<unsigned>(index);
+#elif defined(_MSC_VER)
+        const unsigned low = static_cast<unsigned>(mask);
+        return low ? lowest_bit(low) : 32 + lowest_bit(static_cast<unsigned>(mask >> 32));
+#else
+        return static_cast<unsigned>(__builtin_ctzll(mask));
+#endif
+    }
+
+    ///   
+    inline unsigned bit_count(unsigned mask) {
+#ifdef _MSC_VER
+        return __popcnt(mask);
+#else
+        return static_cast<unsigned>(__builtin_popcount(mask));
+#endif
+    }
+
+    const char* find_any_scalar(const char* p, const char* end, char a, char b, char c) {
+        for (; p < end; ++p) {
+            if (*p == a || *p == b || *p == c) return p;
+        }
+        return end;
+    }
+
+    ///  , '\n'  '"'  len <= 64 
+    std::uint64_t mask_scalar(const char* p, size_t len, char delimiter) {
+        std::uint64_t mask = 0;
+        for (size_t i = 0; i < len; ++i) {
+            if (p[i] == delimiter || p[i] == '\n' || p[i] == '"') mask |= std::uint64_t{ 1 } << i;
+        }
+        return mask;
+    }
+
+#ifndef MONEY_KEEPER_HAS_SSE2
+    ///      SSE2 (. kernels())
+    std::uint64_t mask64_scalar(const char* p, char delimiter) {
+        return mask_scalar(p, 64, delimiter);
+    }
+#endif
+
+    size_t count_scalar(const char* p, const char* end, char c) {
+        size_t n = 0;
+        for (; p < end; ++p) n += (*p == c);
+        return n;
+    }
+
+#ifdef MONEY_KEEPER_HAS_SSE2
+    const char* find_any_sse2(const char* p, const char* end, char a, char b, char c) {
+        const __m128i va = _mm_set1_epi8(a);
+        const __m128i vb = _mm_set1_epi8(b);
+        const __m128i vc = _mm_set1_epi8(c);
+        for (; end - p >= 16; p += 16) {
+            const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            const __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, va), _mm_cmpeq_epi8(x, vb)),
+                _mm_cmpeq_epi8(x, vc));
+            const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hit));
+            if (mask) return p + lowest_bit(mask);
+        }
+        return find_any_scalar(p, end, a, b, c);
+    }
+
+    std::uint64_t mask64_sse2(const char* p, char delimiter) {
+        const __m128i vd = _mm_set1_epi8(delimiter);
+        const __m128i vn = _mm_set1_epi8('\n');
+        const __m128i vq = _mm_set1_epi8('"');
+        std::uint64_t mask = 0;
+        for (int i = 0; i < 4; ++i) {
+            const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * i));
+            const __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, vd), _mm_cmpeq_epi8(x, vn)),
+                _mm_cmpeq_epi8(x, vq));
+            mask |= std::uint64_t{ static_cast<unsigned>(_mm_movemask_epi8(hit)) } << (16 * i);
+        }
+        return mask;
+    }
+
+    size_t count_sse2(const char* p, const char* end, char c) {
+        const __m128i vc = _mm_set1_epi8(c);
+        size_t n = 0;
+        for (; end - p >= 16; p += 16) {
+            const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            n += bit_count(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, vc))));
+        }
+        return n + count_scalar(p, end, c);
+    }
+#endif
+
+#if defined(MONEY_KEEPER_AVX2_DISPATCH) || defined(MONEY_KEEPER_AVX2_STATIC)
+#ifdef MONEY_KEEPER_AVX2_DISPATCH
+#define MONEY_KEEPER_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MONEY_KEEPER_TARGET_AVX2
+#endif
+
+    MONEY_KEEPER_TARGET_AVX2
+    const char* find_any_avx2(const char* p, const char* end, char a, char b, char c) {
+        const __m256i va = _mm256_set1_epi8(a);
+        const __m256i vb = _mm256_set1_epi8(b);
+        const __m256i vc = _mm256_set1_epi8(c);
+        for (; end - p >= 32; p += 32) {
+            const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            const __m256i hit = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(x, va),
+                _mm256_cmpeq_epi8(x, vb)), _mm256_cmpeq_epi8(x, vc));
+            const unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(hit));
+            if (mask) return p + lowest_bit(mask);
+        }
+        return find_any_scalar(p, end, a, b, c);
+    }
+
+    MONEY_KEEPER_TARGET_AVX2
+    std::uint64_t mask64_avx2(const char* p, char delimiter) {
+        const __m256i vd = _mm256_set1_epi8(delimiter);
+        const __m256i vn = _mm256_set1_epi8('\n');
+        const __m256i vq = _mm256_set1_epi8('"');
+        const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32));
+        const __m256i hit_lo = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(lo, vd),
+            _mm256_cmpeq_epi8(lo, vn)), _mm256_cmpeq_epi8(lo, vq));
+        const __m256i hit_hi = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(hi, vd),
+            _mm256_cmpeq_epi8(hi, vn)), _mm256_cmpeq_epi8(hi, vq));
+        return std::uint64_t{ static_cast<std::uint32_t>(_mm256_movemask_epi8(hit_lo)) } |
+            (std::uint64_t{ static_cast<std::uint32_t>(_mm256_movemask_epi8(hit_hi)) } << 32);
+    }
+
+    MONEY_KEEPER_TARGET_AVX2
+    size_t count_avx2(const char* p, const char* end, char c) {
+        const __m256i vc = _mm256_set1_epi8(c);
+        size_t n = 0;
+        for (; end - p >= 32; p += 32) {
+            const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            n += bit_count(static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, vc))));
+        }
+        return n + count_scalar(p, end, c);
+    }
+#endif
+
+    /**
+     * @brief     
+     */
+    struct Kernels {
+        const char* (*find_any)(const char*, const char*, char, char, char);
+        size_t(*count)(const char*, const char*, char);
+        std::uint64_t(*mask64)(const char*, char);
+        const char* name;
+    };
+
+    /**
+     * @brief       
+     */
+    const Kernels& kernels() {
+        static const Kernels selected = [] {
+#if defined(MONEY_KEEPER_AVX2_STATIC)
+            return Kernels{ find_any_avx2, count_avx2, mask64_avx2, "avx2" };
+#else
+#if defined(MONEY_KEEPER_AVX2_DISPATCH)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) return Kernels{ find_any_avx2, count_avx2, mask64_avx2, "avx2" };
+#endif
+#if defined(MONEY_KEEPER_HAS_SSE2)
+            return Kernels{ find_any_sse2, count_sse2, mask64_sse2, "sse2" };
+#else
+            return Kernels{ find_any_scalar, count_scalar, mask64_scalar, "scalar" };
+#endif
+#endif
+        }();
+        return selected;
+    }
+
+} // namespace
+
+CsvTokenizer::CsvTokenizer(std::string_view text, char delimiter)
+    : text_(text), delimiter_(delimiter), mask_fn_(kernels().mask64) {
+    load(text_.data());
+}
+
+const char* CsvTokenizer::find_any(const char* p, const char* end, char a, char b, char c) {
+    return kernels().find_any(p, end, a, b, c);
+}
+
+const char* CsvTokenizer::find_either(const char* p, const char* end, char a, char b) {
+    return kernels().find_any(p, end, a, b, b);
+}
+
+size_t CsvTokenizer::count(std::string_view text, char c) {
+    return kernels().count(text.data(), text.data() + text.size(), c);
+}
+
+const char* CsvTokenizer::isa() {
+    return kernels().name;
+}
+
+/**
+ * @brief    64 ,   p
+ *
+ * @details    ( 64    )
+ *  ,      
+ */
+void CsvTokenizer::load(const char* p) {
+    const size_t left = static_cast<size_t>(text_.data() + text_.size() - p);
+    block_ = p;
+    mask_ = (left >= 64) ? mask_fn_(p, delimiter_) : mask_scalar(p, left, delimiter_);
+}
+
+/**
+ * @brief       
+ * @param p  
+ * @return      
+ *
+ * @details  p   ,  -     ctz.
+ *    ,   
+ */
+const char* CsvTokenizer::scan(const char* p) {
+    const char* const end = text_.data() + text_.size();
+    for (;;) {
+        const size_t offset = static_cast<size_t>(p - block_);
+        if (offset < 64) {
+            const std::uint64_t pending = mask_ >> offset;
+            if (pending) return p + lowest_bit64(pending);
+            p = block_ + 64;
+        }
+        if (p >= end) return end;
+        load(p);
+    }
+}
+
+/**
+ * @brief   
+ * @param fields [out]  
+ * @return false   
+ *
+ * @details   :
+ * -  :       
+ *   (    -  )
+ * -  :   ; ""    ,
+ *         -  .
+ *         
+ *
+ *   ""    ;   
+ *    ,     
+ */
+bool CsvTokenizer::next(std::vector<std::string_view>& fields) {
+    fields.clear();
+    if (pos_ >= text_.size()) return false;
+
+    fixups_.clear();
+    scratch_.clear();
+
+    const char* const end = text_.data() + text_.size();
+    const char* const start = text_.data() + pos_;
+    const char* p = start;
+    line_ = next_line_;
+
+    //   scan():     
+    auto find = [this](const char* from) {
+        const size_t offset = static_cast<size_t>(from - block_);
+        if (offset < 64) {
+            const std::uint64_t pending = mask_ >> offset;
+            if (pending) return from + lowest_bit64(pending);
+        }
+        return scan(from);
+        };
+
+    //      ( )
+    auto field_end = [&](const char* from) {
+        for (;;) {
+            from = find(from);
+            if (from < end && *from == '"') {
+                ++from;
+                continue;
+            }
+            return from;
+        }
+        };
+
+    for (;;) {
+        bool unquoted_tail = false;
+        if (p < end && *p == '"') {
+            const char* q = p + 1;
+            const char* segment = q;
+            bool escaped = false;
+            const size_t offset = scratch_.size();
+            std::string_view value;
+            for (;;) {
+                const char* r = find(q);
+                if (r < end && *r != '"') {
+                    if (*r == '\n') ++next_line_;
+                    q = r + 1;
+                    continue;
+                }
+                if (r + 1 < end && r[1] == '"') {
+                    escaped = true;
+                    scratch_.append(segment, static_cast<size_t>(r + 1 - segment));
+                    q = r + 2;
+                    segment = q;
+                    continue;
+                }
+                if (escaped) {
+                    scratch_.append(segment, static_cast<size_t>(r - segment));
+                }
+                else {
+                    value = std::string_view(p + 1, static_cast<size_t>(r - p - 1));
+                }
+                q = (r < end) ? r + 1 : end;
+                break;
+            }
+
+            if (escaped) {
+                fixups_.push_back({ fields.size(), offset, scratch_.size() - offset });
+            }
+            fields.push_back(value);
+            p = field_end(q);
+        }
+        else {
+            const char* s = field_end(p);
+            fields.emplace_back(p, static_cast<size_t>(s - p));
+            unquoted_tail = true;
+            p = s;
+        }
+
+        if (p < end && *p == delimiter_) {
+            ++p;
+            continue;
+        }
+
+        //  :     
+        if (unquoted_tail && !fields.back().empty() && fields.back().back() == '\r') {
+            fields.back().remove_suffix(1);
+        }
+        record_ = std::string_view(start, static_cast<size_t>(p - start));
+        if (p < end) {
+            ++next_line_;
+            ++p;
+        }
+        pos_ = static_cast<size_t>(p - text_.data());
+        break;
+    }
+
+    for (const auto& fix : fixups_) {
+        fields[fix.field] = std::string_view(scratch_.data() + fix.offset, fix.length);
+    }
+
+    if (!record_.empty() && record_.back() == '\r') record_.remove_suffix(1);
+    return true;
+}
+
+/**
+ * @brief      CSV
+ * @param field 
+ * @param delimiter  
+ * @return    
+ */
+std::string CsvTokenizer::quote(std::string_view field, char delimiter) {
+    const char* special = find_any(field.data(), field.data() + field.size(), delimiter, '"', '\n');
+    const bool has_cr = field.find('\r') != std::string_view::npos;
+    if (!has_cr && special == field.data() + field.size()) return std::string(field);
+
+    std::string quoted;
+    quoted.reserve(field.size() + 2);
+    quoted.push_back('"');
+    for (char c : field) {
+        if (c == '"') quoted.push_back('"');
+        quoted.push_back(c);
+    }
+    quoted.push_back('"');
+    return quoted;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file CsvTokenizer.hpp
+ * @brief  CSV      RFC 4180
+ *
+ * @details :
+ * -         
+ * -   (""    )
+ * -   \n  \r\n
+ *
+ *   (,  , ) 
+ *   64 :     AVX2/SSE2 
+ *   ,      .
+ *      .
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+ /**
+  * @class CsvTokenizer
+  * @brief   CSV-  
+  *
+  * @details    string_view   .
+  *  -    :   
+  *        next()
+  *
+  * @par :
+  * @code
+  * CsvTokenizer csv(text);
+  * std::vector<std::string_view> fields;
+  * while (csv.next(fields)) {
+  *     // fields[0], fields[1], ...
+  * }
+  * @endcode
+  */
+class CsvTokenizer {
+public:
+    /**
+     * @brief   
+     * @param text CSV- (   )
+     * @param delimiter  
+     */
+    explicit CsvTokenizer(std::string_view text, char delimiter = ',');
+
+    /**
+     * @brief   
+     * @param fields [out]   (  )
+     * @return false   
+     *
+     * @note        .
+     *       
+     */
+    bool next(std::vector<std::string_view>& fields);
+
+    /**
+     * @brief      (  )
+     */
+    std::string_view record() const { return record_; }
+
+    /**
+     * @brief  ,      ( 1)
+     */
+    size_t line() const { return line_; }
+
+    /**
+     * @brief ,      
+     * @param field ,   next()
+     * @return true    ,    next()
+     */
+    bool is_transient(std::string_view field) const {
+        return !field.empty() && field.data() >= scratch_.data() &&
+            field.data() < scratch_.data() + scratch_.capacity();
+    }
+
+    /**
+     * @brief     
+     * @return      end
+     */
+    static const char* find_either(const char* p, const char* end, char a, char b);
+
+    /**
+     * @brief     
+     * @return      end
+     */
+    static const char* find_any(const char* p, const char* end, char a, char b, char c);
+
+    /**
+     * @brief   
+     * @param text 
+     * @param c 
+     */
+    static size_t count(std::string_view text, char c);
+
+    /**
+     * @brief     ("avx2", "sse2", "scalar")
+     */
+    static const char* isa();
+
+    /**
+     * @brief      CSV
+     * @param field 
+     * @param delimiter  
+     * @return          
+     *
+     * @details  ,    , 
+     *   
+     */
+    static std::string quote(std::string_view field, char delimiter = ',');
+
+private:
+    ///      64 
+    using MaskFn = std::uint64_t(*)(const char*, char);
+
+    /**
+     * @brief        
+     * @param p ,    (   )
+     * @return   , '\n'  '"',   
+     */
+    const char* scan(const char* p);
+
+    /**
+     * @brief          p
+     */
+    void load(const char* p);
+
+    /**
+     * @brief ,    
+     */
+    struct Fixup {
+        size_t field;   ///<    
+        size_t offset;  ///<   scratch_
+        size_t length;  ///<  
+    };
+
+    std::string_view text_;     ///<  
+    size_t pos_ = 0;            ///<   
+    size_t next_line_ = 1;      ///<     pos_
+    size_t line_ = 0;           ///<    
+    char delimiter_;            ///<  
+    std::string_view record_;   ///<   
+    std::string scratch_;       ///<    
+    std::vector<Fixup> fixups_; ///<   scratch_   
+    MaskFn mask_fn_;            ///<    
+    const char* block_;         ///<   64- 
+    std::uint64_t mask_ = 0;    ///<     
+};
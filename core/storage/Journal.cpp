@@ -0,0 +1,419 @@
+/**
+ * @file Journal.cpp
+ * @brief    
+ *
+ * @details    :
+ * 1.      pending_  
+ * 2.     pending_  (swap)
+ * 3.    write    fsync
+ * 4. durable_lsn_ ,   sync() 
+ *
+ *   fsync,     pending_    .
+ */
+
+#include "Journal.hpp"
+#include "BinaryCodec.hpp"
+#include "MappedFile.hpp"
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+    constexpr size_t FRAME_HEADER = 8;              ///< [u32 ][u32 crc]
+    constexpr std::uint32_t MAX_RECORD = 1u << 24;  ///<    
+
+    int open_append(const std::string& path) {
+#ifdef _WIN32
+        return ::_open(path.c_str(), _O_WRONLY | _O_APPEND | _O_CREAT | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+        return ::open(path.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+#endif
+    }
+
+    void close_fd(int fd) {
+#ifdef _WIN32
+        ::_close(fd);
+#else
+        ::close(fd);
+#endif
+    }
+
+    /**
+     * @brief        
+     * @return false   -
+     */
+    bool write_durable(int fd, const char* data, size_t size) {
+        while (size > 0) {
+#ifdef _WIN32
+            int n = ::_write(fd, data, static_cast<unsigned>(size));
+#else
+            ssize_t n = ::write(fd, data, size);
+#endif
+            if (n < 0) return false;
+            data += n;
+            size -= static_cast<size_t>(n);
+        }
+#if defined(_WIN32)
+        return ::_commit(fd) == 0;
+#elif defined(__APPLE__)
+        return ::fsync(fd) == 0;
+#else
+        return ::fdatasync(fd) == 0;
+#endif
+    }
+
+} // namespace
+
+/**
+ * @brief  
+ * @param path    
+ * @param base_lsn   ,   
+ */
+Journal::Journal(std::string path, std::uint64_t base_lsn) : path_(std::move(path)) {
+    recover();
+    if (next_lsn_ <= base_lsn) next_lsn_ = base_lsn + 1;
+    durable_lsn_ = next_lsn_ - 1;
+
+    fd_ = open_append(path_);
+    if (fd_ < 0) throw std::runtime_error("   : " + path_);
+
+    flusher_ = std::thread(&Journal::flusher_loop, this);
+}
+
+Journal::~Journal() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    pending_cv_.notify_one();
+    if (flusher_.joinable()) flusher_.join();
+    if (fd_ >= 0) close_fd(fd_);
+}
+
+/**
+ * @brief      
+ *
+ * @details         CRC.
+ * ,  ,      .
+ */
+void Journal::recover() {
+    std::error_code ec;
+    if (!std::filesystem::exists(path_, ec)) return;
+
+    size_t valid = 0;
+    std::uint64_t last = 0;
+    {
+        MappedFile file(path_, MappedFile::Access::Sequential);
+        std::string_view raw = file.view();
+        while (raw.size() - valid >= FRAME_HEADER) {
+            const auto* p = reinterpret_cast<const unsigned char*>(raw.data() + valid);
+            std::uint32_t len = ByteReader::load_u32(p);
+            std::uint32_t crc = ByteReader::load_u32(p + 4);
+            if (len < 9 || len > MAX_RECORD || len > raw.size() - valid - FRAME_HEADER) break;
+            if (crc32(p + FRAME_HEADER, len) != crc) break;
+            last = ByteReader::load_u64(p + FRAME_HEADER);
+            valid += FRAME_HEADER + len;
+        }
+        if (valid != raw.size()) {
+            std::cerr << ":  " << raw.size() - valid << "   \n";
+        }
+    }
+    if (valid != std::filesystem::file_size(path_)) {
+        std::filesystem::resize_file(path_, valid);
+    }
+
+    next_lsn_ = last + 1;
+    durable_size_ = valid;
+}
+
+/**
+ * @brief         
+ * @param op  
+ * @param encode      
+ * @return  
+ */
+std::uint64_t Journal::append(JournalRecord::Op op, const std::function<void(std::string&)>& encode) {
+    std::string body;
+    ByteWriter out(body);
+    out.u64(0); //    
+    out.u8(static_cast<std::uint8_t>(op));
+    encode(body);
+
+    std::uint64_t lsn;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (failed_) throw std::runtime_error("    ");
+        lsn = next_lsn_++;
+        for (int i = 0; i < 8; ++i) body[i] = static_cast<char>((lsn >> (8 * i)) & 0xFF);
+
+        ByteWriter frame(pending_);
+        frame.u32(static_cast<std::uint32_t>(body.size()));
+        frame.u32(crc32(body.data(), body.size()));
+        pending_ += body;
+        ++stats_.records;
+    }
+    pending_cv_.notify_one();
+    return lsn;
+}
+
+std::uint64_t Journal::log_create_account(const std::string& account) {
+    return append(JournalRecord::Op::CreateAccount, [&](std::string& b) { ByteWriter(b).str(account); });
+}
+
+std::uint64_t Journal::log_delete_account(const std::string& account) {
+    return append(JournalRecord::Op::DeleteAccount, [&](std::string& b) { ByteWriter(b).str(account); });
+}
+
+std::uint64_t Journal::log_add(const std::string& account, const Transaction& t) {
+    return append(JournalRecord::Op::AddTransaction, [&](std::string& b) {
+        ByteWriter out(b);
+        out.str(account);
+        out.u64(static_cast<std::uint64_t>(static_cast<std::int64_t>(t.id)));
+        out.u64(static_cast<std::uint64_t>(t.amount));
+        out.u8(static_cast<std::uint8_t>(t.type));
+        const Date::YearMonthDay ymd = t.date.civil();
+        out.u16(static_cast<std::uint16_t>(ymd.year));
+        out.u8(static_cast<std::uint8_t>(ymd.month));
+        out.u8(static_cast<std::uint8_t>(ymd.day));
+        out.str(t.category.view());
+        out.str(t.description);
+        out.str(t.currency_.view());
+        out.u8(static_cast<std::uint8_t>(TagCatalogue::count(t.tags_)));
+        for (std::string_view tag : TagCatalogue::names(t.tags_)) out.str(tag);
+        });
+}
+
+std::uint64_t Journal::log_remove(const std::string& account, TransactionId transaction_id) {
+    return append(JournalRecord::Op::RemoveTransaction, [&](std::string& b) {
+        ByteWriter out(b);
+        out.str(account);
+        out.u64(static_cast<std::uint64_t>(transaction_id));
+        });
+}
+
+std::uint64_t Journal::log_rename(const std::string& from, const std::string& to) {
+    return append(JournalRecord::Op::RenameAccount, [&](std::string& b) {
+        ByteWriter out(b);
+        out.str(from);
+        out.str(to);
+        });
+}
+
+std::uint64_t Journal::log_merge(const std::string& from, const std::string& to) {
+    return append(JournalRecord::Op::MergeAccount, [&](std::string& b) {
+        ByteWriter out(b);
+        out.str(from);
+        out.str(to);
+        });
+}
+
+/**
+ * @brief     
+ *
+ * @details       
+ *    fsync.    
+ *   .
+ */
+void Journal::flusher_loop() {
+    std::string batch;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        pending_cv_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+        if (pending_.empty()) break; // stop_   
+
+        batch.clear();
+        batch.swap(pending_);
+        const std::uint64_t batch_lsn = next_lsn_ - 1;
+
+        lock.unlock();
+        std::unique_lock<std::mutex> io(io_mutex_);
+        const bool ok = write_durable(fd_, batch.data(), batch.size());
+        lock.lock();
+        io.unlock();
+
+        if (!ok) {
+            failed_ = true;
+            durable_cv_.notify_all();
+            std::cerr << ":   " << path_ << "\n";
+            break;
+        }
+        durable_lsn_ = batch_lsn;
+        durable_size_ += batch.size();
+        ++stats_.batches;
+        stats_.bytes += batch.size();
+        durable_cv_.notify_all();
+    }
+}
+
+/**
+ * @brief      
+ */
+void Journal::sync() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    const std::uint64_t target = next_lsn_ - 1;
+    durable_cv_.wait(lock, [this, target] { return failed_ || durable_lsn_ >= target; });
+    if (failed_ && durable_lsn_ < target) throw std::runtime_error("  : " + path_);
+}
+
+/**
+ * @brief       <= lsn
+ * @param lsn   ,   
+ * @return   
+ *
+ * @details :
+ * 1.    (io_mutex_)
+ * 2.      > lsn
+ * 3.     ,  fsync
+ * 4.        
+ */
+std::uint64_t Journal::compact_through(std::uint64_t lsn) {
+    std::lock_guard<std::mutex> io(io_mutex_);
+    std::uint64_t size;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size = durable_size_;
+    }
+    if (size == 0) return 0;
+
+    std::string tail;
+    size_t keep_from = static_cast<size_t>(size);
+    {
+        MappedFile file(path_, MappedFile::Access::Sequential);
+        std::string_view raw = file.view().substr(0, static_cast<size_t>(size));
+        size_t offset = 0;
+        while (offset < raw.size()) {
+            const auto* p = reinterpret_cast<const unsigned char*>(raw.data() + offset);
+            if (ByteReader::load_u64(p + FRAME_HEADER) > lsn) {
+                keep_from = offset;
+                break;
+            }
+            offset += FRAME_HEADER + ByteReader::load_u32(p);
+        }
+        if (keep_from == 0) return 0;
+        tail.assign(raw.substr(keep_from));
+    }
+
+    const std::string tmp_path = path_ + ".tmp";
+    std::filesystem::remove(tmp_path);
+    int tmp = open_append(tmp_path);
+    if (tmp < 0) throw std::runtime_error("   : " + tmp_path);
+    const bool ok = write_durable(tmp, tail.data(), tail.size());
+    close_fd(tmp);
+    if (!ok) throw std::runtime_error("  : " + tmp_path);
+
+    close_fd(fd_);
+    std::filesystem::rename(tmp_path, path_);
+    fd_ = open_append(path_);
+    if (fd_ < 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        failed_ = true;
+        durable_cv_.notify_all();
+        throw std::runtime_error("   : " + path_);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    durable_size_ = tail.size();
+    return keep_from;
+}
+
+std::uint64_t Journal::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return durable_size_;
+}
+
+std::uint64_t Journal::last_lsn() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return next_lsn_ - 1;
+}
+
+Journal::Stats Journal::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+/**
+ * @brief    
+ * @param after_lsn     <= after_lsn
+ * @param apply  
+ *
+ * @throws std::runtime_error       
+ */
+void Journal::replay(std::uint64_t after_lsn, const std::function<void(const JournalRecord&)>& apply) const {
+    size_t limit;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        limit = static_cast<size_t>(durable_size_);
+    }
+    if (limit == 0) return;
+
+    MappedFile file(path_, MappedFile::Access::Sequential);
+    ByteReader frames(file.view().substr(0, limit));
+
+    while (!frames.at_end()) {
+        std::uint32_t len = frames.u32();
+        frames.u32(); // CRC    recover()
+        const auto* body = frames.take(len);
+        ByteReader in(std::string_view(reinterpret_cast<const char*>(body), len));
+
+        JournalRecord record;
+        record.lsn = in.u64();
+        if (record.lsn <= after_lsn) continue;
+        record.op = static_cast<JournalRecord::Op>(in.u8());
+        record.account = std::string(in.str());
+
+        switch (record.op) {
+        case JournalRecord::Op::CreateAccount:
+        case JournalRecord::Op::DeleteAccount:
+            break;
+        case JournalRecord::Op::RenameAccount:
+        case JournalRecord::Op::MergeAccount:
+            record.target = std::string(in.str());
+            break;
+        case JournalRecord::Op::RemoveTransaction:
+            record.transaction_id = static_cast<TransactionId>(in.u64());
+            break;
+        case JournalRecord::Op::AddTransaction:
+        case JournalRecord::Op::AddTransactionF64: {
+            auto id64 = static_cast<TransactionId>(in.u64());
+            if (id64 <= 0) {
+                throw std::runtime_error(" : ID  ");
+            }
+            //  1    f64:     
+            const std::int64_t amount = record.op == JournalRecord::Op::AddTransaction
+                ? static_cast<std::int64_t>(in.u64())
+                : Money::round_minor(in.f64() * Money::SCALE);
+            auto type = in.u8();
+            if (type > static_cast<std::uint8_t>(Transaction::Type::EXPENSE)) {
+                throw std::runtime_error(" :   ");
+            }
+            int year = in.u16();
+            int month = in.u8();
+            int day = in.u8();
+            Symbol category(in.str());
+            std::string description(in.str());
+            Symbol currency(in.str());
+
+            Transaction t(id64, amount, static_cast<Transaction::Type>(type),
+                Date(year, month, day), category, std::move(description), currency);
+            for (std::uint8_t k = in.u8(); k > 0; --k) t.tags_ |= TagMask(1) << TagCatalogue::bit(in.str());
+            record.op = JournalRecord::Op::AddTransaction;
+            record.transaction_id = t.id;
+            record.transaction = std::move(t);
+            break;
+        }
+        default:
+            throw std::runtime_error(" :  ");
+        }
+        apply(record);
+    }
+}
@@ -0,0 +1,208 @@
+/**
+ * @file Journal.hpp
+ * @brief    (write-ahead log)   
+ *
+ * @details        
+ *        transactions.snap:
+ * -     ,   
+ * -        fsync  
+ * -       
+ *
+ * @section journal_layout   (little-endian)
+ * |         |  |                                     |
+ * |-------------|--------|---------------------------------------------|
+ * | length      | u32    |                             |
+ * | crc         | u32    | CRC-32                                  |
+ * | lsn         | u64    |    ( )       |
+ * | op          | u8     |   (JournalRecord::Op)            |
+ * | ...         |        |                                 |
+ *
+ *     :  
+ *   AddTransaction ( 2,  - i64  
+ *  ).  AddTransactionF64 ( 1,  f64)
+ *  :     .
+ *
+ * @note        (  
+ * )    
+ */
+
+#pragma once
+#include "../Time_Manager.hpp"
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+
+ /**
+  * @struct JournalRecord
+  * @brief    
+  */
+struct JournalRecord {
+    /**
+     * @enum Op
+     * @brief  
+     */
+    enum class Op : std::uint8_t {
+        CreateAccount = 1,     ///<    (account)
+        DeleteAccount = 2,     ///<   (account)
+        AddTransactionF64 = 3, ///<    account,  f64 ( 1,  )
+        RemoveTransaction = 4, ///<  transaction_id   account
+        RenameAccount = 5,     ///<  account   target
+        MergeAccount = 6,      ///<  account   target
+        AddTransaction = 7     ///<    account,  i64   
+    };
+
+    std::uint64_t lsn = 0;                  ///<  
+    Op op = Op::CreateAccount;              ///<  
+    std::string account;                    ///< ,    
+    std::string target;                     ///<   (/)
+    TransactionId transaction_id = 0;       ///< ID  RemoveTransaction
+    std::optional<Transaction> transaction; ///<   AddTransaction
+};
+
+/**
+ * @class Journal
+ * @brief Append-only    
+ *
+ * @details  log_*       
+ *  .     ,
+ *     write    fsync   .
+ * sync()        .
+ *
+ *        apply_guard().
+ * freeze()         :
+ *     <= last_lsn()  ,   .
+ *
+ * @note 
+ */
+class Journal {
+public:
+    /**
+     * @brief  
+     */
+    struct Stats {
+        std::uint64_t records = 0;  ///<  
+        std::uint64_t batches = 0;  ///<  fsync ()
+        std::uint64_t bytes = 0;    ///<  
+    };
+
+    /**
+     * @brief   (  )
+     * @param path    
+     * @param base_lsn   ,   :
+     *      ,    
+     * @throws std::runtime_error     
+     *
+     * @details    
+     */
+    Journal(std::string path, std::uint64_t base_lsn);
+
+    /**
+     * @brief       
+     */
+    ~Journal();
+
+    Journal(const Journal&) = delete;
+    Journal& operator=(const Journal&) = delete;
+
+    /// @name  
+    /// @{
+    std::uint64_t log_create_account(const std::string& account);
+    std::uint64_t log_delete_account(const std::string& account);
+    std::uint64_t log_add(const std::string& account, const Transaction& t);
+    std::uint64_t log_remove(const std::string& account, TransactionId transaction_id);
+    std::uint64_t log_rename(const std::string& from, const std::string& to);
+    std::uint64_t log_merge(const std::string& from, const std::string& to);
+    /// @}
+
+    /**
+     * @brief     "  "
+     * @return ,      
+     *
+     * @warning  :      
+     *  ,   freeze()
+     */
+    std::shared_lock<std::shared_mutex> apply_guard() {
+        return std::shared_lock<std::shared_mutex>(cut_mutex_);
+    }
+
+    /**
+     * @brief     
+     * @return ,       
+     */
+    std::unique_lock<std::shared_mutex> freeze() {
+        return std::unique_lock<std::shared_mutex>(cut_mutex_);
+    }
+
+    /**
+     * @brief     ,    
+     * @param lsn   ,   
+     * @return   
+     * @throws std::runtime_error   -
+     *
+     * @details      ,
+     *    .    
+     *         
+     */
+    std::uint64_t compact_through(std::uint64_t lsn);
+
+    /**
+     * @brief      
+     */
+    std::uint64_t size() const;
+
+    /**
+     * @brief        
+     * @throws std::runtime_error     
+     */
+    void sync();
+
+    /**
+     * @brief   
+     * @param after_lsn     <= after_lsn
+     * @param apply      
+     *
+     * @note     
+     */
+    void replay(std::uint64_t after_lsn, const std::function<void(const JournalRecord&)>& apply) const;
+
+    /**
+     * @brief    
+     */
+    std::uint64_t last_lsn() const;
+
+    /**
+     * @brief  
+     */
+    Stats stats() const;
+
+    const std::string& path() const { return path_; } ///<    
+
+private:
+    std::uint64_t append(JournalRecord::Op op, const std::function<void(std::string&)>& encode);
+    void flusher_loop();
+    void write_batch(const std::string& batch);
+    void recover();
+
+    std::string path_;                 ///<   
+    int fd_ = -1;                      ///<   
+    std::mutex io_mutex_;              ///<      
+    std::shared_mutex cut_mutex_;      ///< . apply_guard() / freeze()
+
+    mutable std::mutex mutex_;         ///<   
+    std::condition_variable pending_cv_;  ///<   
+    std::condition_variable durable_cv_;  ///<    sync()
+    std::string pending_;              ///< ,    
+    std::uint64_t next_lsn_ = 1;       ///<   
+    std::uint64_t durable_lsn_ = 0;    ///<   
+    std::uint64_t durable_size_ = 0;   ///<    
+    bool stop_ = false;                ///<   
+    bool failed_ = false;              ///<   
+    Stats stats_;                      ///< 
+
+    std::thread flusher_;              ///<   
+};
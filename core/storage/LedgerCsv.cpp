@@ -0,0 +1,538 @@
+/**
+ * @file LedgerCsv.cpp
+ * @brief     
+ *
+ * @details   :
+ * 1.  [Account:]   
+ * 2.      CsvTokenizer (RFC 4180)
+ * 3.     "yyyy mm dd"
+ * 4.     , "-"   
+ *
+ *   (parse_parallel)     
+ *  ,       
+ *   . parse() -      .
+ */
+
+#include "LedgerCsv.hpp"
+#include "Parallel.hpp"
+#include <iostream>
+#include <algorithm>
+#include <charconv>
+#include <cctype>
+#include <initializer_list>
+#include <iterator>
+#include <thread>
+#include <unordered_set>
+
+ /**
+  * @brief    
+  * @param vec  ( )
+  * @param delimiter 
+  * @return  
+  *
+  * @par :
+  * @code
+  * join_strings({"food","transport"}, ';') => "food;transport"
+  * @endcode
+  */
+static std::string join_strings(const std::vector<std::string_view>& vec, const char delimiter) {
+    std::string result;
+    for (size_t i = 0; i < vec.size(); ++i) {
+        if (i != 0) result += delimiter;
+        result += vec[i];
+    }
+    return result;
+}
+
+/**
+ * @brief    CSV
+ * @param os  
+ * @param accounts   
+ *
+ * @details          .
+ *    CsvTokenizer::quote
+ */
+void LedgerCsv::write(std::ostream& os, const std::map<std::string, Account>& accounts) {
+    for (const auto& [name, account] : accounts) {
+        os << "[Account:" << name << "]\n";
+        for (const auto& t : account.get_transactions()) {
+            os << t.get_id() << ","
+                << t.get_amount() << ","
+                << static_cast<int>(t.get_type()) << ","
+                << CsvTokenizer::quote(t.get_category()) << ","
+                << t.get_date() << ","
+                << CsvTokenizer::quote(t.get_currency()) << ","
+                << CsvTokenizer::quote(t.get_description()) << ","
+                << (t.get_tags().empty() ? "-" : CsvTokenizer::quote(join_strings(t.get_tags(), ';'))) << "\n";
+        }
+    }
+}
+
+/**
+ * @brief  CSV-  LedgerData
+ * @param is  
+ * @return     ID
+ *
+ * @details      , 
+ *    ,     
+ */
+LedgerData LedgerCsv::read(std::istream& is) {
+    std::string text((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+    return parse(text);
+}
+
+namespace {
+
+    /**
+     * @brief      
+     */
+    std::string_view trim(std::string_view s) {
+        size_t begin = s.find_first_not_of(" \t");
+        if (begin == std::string_view::npos) return {};
+        size_t end = s.find_last_not_of(" \t");
+        return s.substr(begin, end - begin + 1);
+    }
+
+    /**
+     * @brief     std::from_chars
+     * @param s  (  )
+     * @param what      
+     * @param rest [out]   
+     */
+    template <typename Int = int>
+    Int parse_int(std::string_view s, const char* what, std::string_view* rest = nullptr) {
+        s = s.substr(std::min(s.find_first_not_of(' '), s.size()));
+        Int value = 0;
+        auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), value);
+        if (ec != std::errc() || ptr == s.data()) {
+            throw std::runtime_error(std::string("  ") + what);
+        }
+        if (rest) *rest = s.substr(static_cast<size_t>(ptr - s.data()));
+        return value;
+    }
+
+    /**
+     * @brief       std::from_chars
+     */
+    double parse_double(std::string_view s, const char* what) {
+        s = trim(s);
+        double value = 0.0;
+        auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), value);
+        if (ec != std::errc() || ptr == s.data()) {
+            throw std::runtime_error(std::string("  ") + what);
+        }
+        return value;
+    }
+
+    /**
+     * @brief     
+     *
+     * @details     (Money::parse_minor).
+     *      
+     * (1.5e+06) -    double  
+     */
+    std::int64_t parse_amount(std::string_view s) {
+        s = trim(s);
+        std::int64_t minor = 0;
+        if (Money::parse_minor(s, minor)) return minor;
+        return Money::round_minor(parse_double(s, "amount") * Money::SCALE);
+    }
+
+} // namespace
+
+/**
+ * @brief     
+ * @param line  
+ * @param name [out]    "[Account:"  "]"
+ * @return true   
+ */
+bool LedgerCsv::parse_header(std::string_view line, std::string_view& name) {
+    constexpr std::string_view prefix = "[Account:";
+    if (line.substr(0, prefix.size()) != prefix) return false;
+    size_t end = line.find(']');
+    if (end == std::string_view::npos) return false;
+    name = line.substr(prefix.size(), end - prefix.size());
+    return true;
+}
+
+/**
+ * @brief       
+ * @param fields  id,amount,type,category,yyyy mm dd,currency,description,tags
+ * @return   -  fields
+ *
+ * @details   std::from_chars,  -     
+ */
+TransactionView LedgerCsv::parse_record(const std::vector<std::string_view>& fields) {
+    const size_t count = fields.size();
+    if (count < 6) throw std::runtime_error(" ");
+
+    //  
+    TransactionId id = parse_int<TransactionId>(fields[0], "id");
+    std::int64_t amount = parse_amount(fields[1]);
+    const int type_code = parse_int(fields[2], "type");
+    if (type_code < 0 || type_code > static_cast<int>(Transaction::Type::EXPENSE)) {
+        throw std::runtime_error("  ");
+    }
+    auto type = static_cast<Transaction::Type>(type_code);
+
+    //  
+    std::string_view rest = fields[4];
+    int y = parse_int(rest, "date", &rest);
+    int m = parse_int(rest, "date", &rest);
+    int d = parse_int(rest, "date", &rest);
+
+    //  
+    std::string_view currency = trim(fields[5]);
+    if (currency.empty()) currency = "RUB";
+
+    //  :        
+    std::string_view description = (count > 6) ? fields[6] : std::string_view("--");
+    if (count > 8) {
+        const std::string_view& last = fields[count - 2];
+        bool contiguous = true;
+        for (size_t i = 7; i < count - 1 && contiguous; ++i) {
+            contiguous = fields[i].data() == fields[i - 1].data() + fields[i - 1].size() + 1;
+        }
+        if (contiguous) {
+            description = std::string_view(fields[6].data(),
+                static_cast<size_t>(last.data() + last.size() - fields[6].data()));
+        }
+    }
+    description = trim(description);
+    std::string_view tags = (count > 7 && fields[count - 1] != "-") ? fields[count - 1] : std::string_view();
+
+    return TransactionView{ id, amount, type, Date(y, m, d), fields[3], currency, description, tags };
+}
+
+/**
+ * @brief    Transaction
+ * @param view  
+ * @return ,     
+ */
+Transaction LedgerCsv::to_transaction(const TransactionView& view) {
+    Transaction t(view.id, view.amount, view.type, view.date, Symbol(view.category),
+        std::string(view.description), Symbol(view.currency));
+    t.tags_ = parse_tags(view.tags);
+    return t;
+}
+
+TagMask LedgerCsv::parse_tags(std::string_view tags) {
+    TagMask mask = 0;
+    while (!tags.empty()) {
+        size_t sep = tags.find(';');
+        std::string_view tag = tags.substr(0, sep);
+        if (!tag.empty()) {
+            if (TagCatalogue::count(mask) >= static_cast<int>(Transaction::MAX_TAGS)) {
+                throw std::runtime_error("   (" + std::to_string(Transaction::MAX_TAGS) + ")");
+            }
+            const TagMask bit = TagMask(1) << TagCatalogue::bit(tag);
+            if (mask & bit) throw std::runtime_error(" '" + std::string(tag) + "'  ");
+            mask |= bit;
+        }
+        if (sep == std::string_view::npos) break;
+        tags.remove_prefix(sep + 1);
+    }
+    return mask;
+}
+
+/**
+ * @details    :     
+ */
+void LedgerCsv::append_to(const TransactionView& view, TransactionStore& rows) {
+    const TagMask tags = parse_tags(view.tags);
+    rows.emplace_back(view.id, view.amount, view.type, view.date, Symbol(view.category),
+        view.description, Symbol(view.currency), tags);
+}
+
+namespace {
+
+    /**
+     * @brief     
+     * @param column    
+     * @param names  (   ,  -  )
+     * @note     
+     */
+    bool column_is(std::string_view column, std::initializer_list<std::string_view> names) {
+        column = trim(column);
+        for (std::string_view name : names) {
+            if (column.size() != name.size()) continue;
+            size_t i = 0;
+            while (i < name.size() &&
+                std::tolower(static_cast<unsigned char>(column[i])) == static_cast<unsigned char>(name[i])) {
+                ++i;
+            }
+            if (i == name.size()) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief    
+     * @details      
+     *     ("-1 234,50")
+     */
+    std::int64_t parse_statement_amount(std::string_view s) {
+        char buffer[64];
+        size_t n = 0;
+        for (char c : trim(s)) {
+            if (c == ' ') continue;
+            if (n == sizeof(buffer)) throw std::runtime_error("  amount");
+            buffer[n++] = (c == ',') ? '.' : c;
+        }
+        return parse_amount(std::string_view(buffer, n));
+    }
+
+    /**
+     * @brief     (yyyy-mm-dd  dd.mm.yyyy)
+     */
+    Date parse_statement_date(std::string_view s) {
+        s = trim(s);
+        std::string_view rest = s;
+        int first = parse_int(rest, "date", &rest);
+        if (rest.empty() || (rest[0] != '-' && rest[0] != '.')) throw std::runtime_error("  date");
+        const char sep = rest[0];
+        int second = parse_int(rest.substr(1), "date", &rest);
+        if (rest.empty() || rest[0] != sep) throw std::runtime_error("  date");
+        int third = parse_int(rest.substr(1), "date", &rest);
+        return (sep == '-') ? Date(first, second, third) : Date(third, second, first);
+    }
+
+} // namespace
+
+/**
+ * @brief   
+ * @param text  
+ * @return   ID
+ *
+ * @details :
+ * 1.      (';'   ,  ',')
+ * 2.      
+ * 3.       ( > 0)
+ *      ( < 0);    
+ */
+std::vector<Transaction> LedgerCsv::parse_statement(std::string_view text) {
+    const std::string_view first_line = text.substr(0, text.find('\n'));
+    const char delimiter = (CsvTokenizer::count(first_line, ';') > CsvTokenizer::count(first_line, ',')) ? ';' : ',';
+
+    constexpr size_t NONE = static_cast<size_t>(-1);
+    size_t date_col = NONE, amount_col = NONE, description_col = NONE, category_col = NONE, currency_col = NONE;
+
+    CsvTokenizer csv(text, delimiter);
+    std::vector<std::string_view> fields;
+    if (csv.next(fields)) {
+        for (size_t i = 0; i < fields.size(); ++i) {
+            if (column_is(fields[i], { "date", "", "" })) date_col = i;
+            else if (column_is(fields[i], { "amount", "", "" })) amount_col = i;
+            else if (column_is(fields[i], { "description", "", "" })) description_col = i;
+            else if (column_is(fields[i], { "category", "", "" })) category_col = i;
+            else if (column_is(fields[i], { "currency", "", "" })) currency_col = i;
+        }
+    }
+    if (date_col == NONE || amount_col == NONE) {
+        throw std::runtime_error("       ");
+    }
+
+    auto column = [&](size_t index, std::string_view fallback) {
+        std::string_view value = (index < fields.size()) ? trim(fields[index]) : std::string_view();
+        return value.empty() ? fallback : value;
+        };
+
+    std::vector<Transaction> result;
+    while (csv.next(fields)) {
+        if (fields.size() == 1 && fields[0].empty()) continue;
+        try {
+            if (date_col >= fields.size() || amount_col >= fields.size()) {
+                throw std::runtime_error(" ");
+            }
+            const std::int64_t amount = parse_statement_amount(fields[amount_col]);
+            if (amount == 0) throw std::runtime_error(" ");
+
+            TransactionView view{ 0, amount < 0 ? -amount : amount,
+                amount < 0 ? Transaction::Type::EXPENSE : Transaction::Type::INCOME,
+                parse_statement_date(fields[date_col]),
+                column(category_col, "Uncategorized"),
+                column(currency_col, "RUB"),
+                column(description_col, "--"),
+                std::string_view() };
+            result.push_back(to_transaction(view));
+        }
+        catch (const std::exception& e) {
+            std::cerr << "  : " << e.what()
+                << "\n " << csv.line() << ": " << csv.record() << "\n";
+        }
+    }
+    return result;
+}
+
+namespace {
+
+    constexpr size_t MIN_PARALLEL_BYTES = 1 << 20;  ///<    
+    constexpr unsigned CHUNKS_PER_THREAD = 4;       ///<    ( )
+
+    /**
+     * @brief       
+     */
+    struct Segment {
+        bool has_header = false;       ///< false -     
+        std::string name;              ///<   ( has_header)
+        TransactionStore rows;         ///<    
+    };
+
+    /**
+     * @brief    
+     */
+    struct ChunkResult {
+        std::vector<Segment> segments; ///<    
+        TransactionId max_id = 0;      ///<  ID  
+        std::string errors;            ///<    
+    };
+
+    /**
+     * @brief   ,    
+     * @param text 
+     * @param out [out] ,  ID  
+     */
+    void parse_chunk(std::string_view text, ChunkResult& out) {
+        out.segments.emplace_back();
+        LedgerCsv::for_each_record(text, [&](const CsvTokenizer& csv, const std::vector<std::string_view>& fields) {
+            std::string_view name;
+            if (LedgerCsv::parse_header(csv.record(), name)) {
+                Segment segment;
+                segment.has_header = true;
+                segment.name = std::string(name);
+                out.segments.push_back(std::move(segment));
+                return;
+            }
+
+            try {
+                TransactionView view = LedgerCsv::parse_record(fields);
+                LedgerCsv::append_to(view, out.segments.back().rows);
+                if (view.id > out.max_id) out.max_id = view.id;
+            }
+            catch (const std::exception& e) {
+                out.errors += "  : ";
+                out.errors += e.what();
+                out.errors += "\n ";
+                out.errors += std::to_string(csv.line());
+                out.errors += ": ";
+                out.errors += csv.record();
+                out.errors += "\n";
+            }
+            });
+    }
+
+    /**
+     * @brief      ID
+     * @param rows     
+     * @param errors [out]    
+     *
+     * @details   ,    Account::addTransaction
+     */
+    void drop_duplicate_ids(TransactionStore& rows, std::string& errors) {
+        std::unordered_set<TransactionId> seen;
+        seen.reserve(rows.size());
+        rows.remove_if([&](const TransactionStore::Row& t) {
+            if (seen.insert(t.get_id()).second) return false;
+            errors += "  : Transaction ID already exists\nID: "
+                + std::to_string(t.get_id()) + "\n";
+            return true;
+            });
+    }
+
+    /**
+     * @brief       
+     * @param text  
+     * @param count   
+     * @return  ,   
+     *
+     * @details        
+     *  .     ,  
+     * '\n'-      
+     * ( ,    )
+     */
+    std::vector<std::string_view> split_records(std::string_view text, size_t count) {
+        std::vector<std::string_view> chunks;
+        size_t begin = 0;
+        size_t quotes = 0; //   text[0, begin)
+        for (size_t i = 1; i <= count && begin < text.size(); ++i) {
+            size_t end = (i == count) ? text.size() : text.size() / count * i;
+            if (end <= begin) continue;
+            size_t scanned = begin;
+            for (;;) {
+                end = text.find('\n', end);
+                if (end == std::string_view::npos) {
+                    end = text.size();
+                    break;
+                }
+                quotes += CsvTokenizer::count(text.substr(scanned, end - scanned), '"');
+                scanned = end;
+                if (quotes % 2 == 0) {
+                    ++end;
+                    break;
+                }
+                ++end; // '\n'   -  
+            }
+            quotes += CsvTokenizer::count(text.substr(scanned, end - scanned), '"');
+            chunks.push_back(text.substr(begin, end - begin));
+            begin = end;
+        }
+        return chunks;
+    }
+
+} // namespace
+
+/**
+ * @brief  CSV-   
+ * @param text  
+ * @return     ID
+ *
+ * @details        "".
+ *  ID   ,    
+ * Account::addTransaction
+ */
+LedgerData LedgerCsv::parse(std::string_view text) {
+    return parse_parallel(text, 1);
+}
+
+/**
+ * @brief  CSV-  
+ * @param text  
+ * @param threads   (0 - std::thread::hardware_concurrency)
+ * @return     ID
+ *
+ * @details :
+ * 1.    threads * CHUNKS_PER_THREAD    
+ * 2.    (parse_chunk)
+ * 3.    :    
+ *        (   - "")
+ * 4. max_id -   
+ * 5.   ID,   
+ */
+LedgerData LedgerCsv::parse_parallel(std::string_view text, unsigned threads) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    if (text.size() < MIN_PARALLEL_BYTES) threads = 1;
+
+    const auto chunks = split_records(text, threads == 1 ? 1 : size_t{ threads } * CHUNKS_PER_THREAD);
+    std::vector<ChunkResult> results(chunks.size());
+    run_parallel(chunks.size(), threads, [&](size_t i) { parse_chunk(chunks[i], results[i]); });
+
+    LedgerData data;
+    std::string current = "";
+    data.accounts[current];
+    for (auto& result : results) {
+        for (auto& segment : result.segments) {
+            if (segment.has_header) current = std::move(segment.name);
+            data.accounts[current].append(std::move(segment.rows));
+        }
+        data.max_id = std::max(data.max_id, result.max_id);
+        std::cerr << result.errors;
+    }
+
+    std::vector<TransactionStore*> lists;
+    for (auto& [name, rows] : data.accounts) lists.push_back(&rows);
+    std::vector<std::string> errors(lists.size());
+    run_parallel(lists.size(), threads, [&](size_t i) { drop_duplicate_ids(*lists[i], errors[i]); });
+    for (const auto& message : errors) std::cerr << message;
+
+    return data;
+}
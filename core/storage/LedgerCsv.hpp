@@ -0,0 +1,177 @@
+/**
+ * @file LedgerCsv.hpp
+ * @brief     (/)
+ *
+ * @details   transactions.dat:
+ * -     [Account:]
+ * -      CSV-
+ *
+ *        :
+ * -    
+ * -    
+ * -  
+ */
+
+#pragma once
+#include "CsvTokenizer.hpp"
+#include "LedgerData.hpp"
+#include "../Account.hpp"
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+ /**
+  * @struct TransactionView
+  * @brief   CSV    
+  *
+  * @details       (, 
+  *  MappedFile)  ,   .
+  *      Transaction  LedgerCsv::to_transaction
+  */
+struct TransactionView {
+    TransactionId id;             ///< ID 
+    std::int64_t amount;          ///<      ()
+    Transaction::Type type;       ///<  
+    Date date;                    ///<  
+    std::string_view category;    ///< 
+    std::string_view currency;    ///<   (  ,   RUB)
+    std::string_view description; ///<  (  )
+    std::string_view tags;        ///<   ';'   
+};
+
+ /**
+  * @class LedgerCsv
+  * @brief       CSV
+  *
+  * @par   :
+  * @code
+  * id,amount,type,category,yyyy mm dd,currency,description,tags
+  * @endcode
+  *
+  *    ,    
+  *     RFC 4180
+  */
+class LedgerCsv {
+public:
+    /**
+     * @brief     
+     * @param os  
+     * @param accounts   
+     */
+    static void write(std::ostream& os, const std::map<std::string, Account>& accounts);
+
+    /**
+     * @brief  CSV-
+     * @param is  
+     * @return ,   
+     *
+     * @note   ,    parse()
+     */
+    static LedgerData read(std::istream& is);
+
+    /**
+     * @brief  CSV-   
+     * @param text   (, MappedFile::view())
+     * @return ,   
+     *
+     * @note       stderr,
+     *       ID 
+     */
+    static LedgerData parse(std::string_view text);
+
+    /**
+     * @brief  CSV-   
+     * @param text  
+     * @param threads   (0 -   )
+     * @return  ,   parse()
+     *
+     * @details       , 
+     *  ,      
+     *  .       
+     *      
+     *
+     * @note      
+     */
+    static LedgerData parse_parallel(std::string_view text, unsigned threads = 0);
+
+    /**
+     * @brief   
+     * @param text   
+     * @return     (ID = 0,     )
+     * @throws std::runtime_error        
+     *
+     * @details   -    :
+     * date/, amount/, description/, category/,
+     * currency/ ( ). 
+     * (','  ';')   .   - .
+     *    yyyy-mm-dd  dd.mm.yyyy
+     *
+     * @note       stderr
+     */
+    static std::vector<Transaction> parse_statement(std::string_view text);
+
+    /**
+     * @brief     
+     * @param fields   ( CsvTokenizer)
+     * @return     
+     * @throws std::runtime_error      
+     * @throws std::invalid_argument   
+     *
+     * @note       ;  
+     *  ,     
+     */
+    static TransactionView parse_record(const std::vector<std::string_view>& fields);
+
+    /**
+     * @brief     
+     * @param view  
+     * @return     
+     * @throws std::runtime_error    
+     */
+    static Transaction to_transaction(const TransactionView& view);
+
+    /**
+     * @brief    "a;b;c"   
+     * @param tags      (  )
+     * @return  
+     * @throws std::runtime_error      ,
+     *  Transaction::add_tag
+     */
+    static TagMask parse_tags(std::string_view tags);
+
+    /**
+     * @brief     
+     * @param view  
+     * @param rows [out] :     
+     * @throws std::runtime_error    
+     */
+    static void append_to(const TransactionView& view, TransactionStore& rows);
+
+    /**
+     * @brief   CSV-
+     * @param text 
+     * @param fn   fn(csv, fields)    
+     *
+     * @note       
+     *  fn (. CsvTokenizer::is_transient)
+     */
+    template <typename Fn>
+    static void for_each_record(std::string_view text, Fn&& fn) {
+        CsvTokenizer csv(text);
+        std::vector<std::string_view> fields;
+        while (csv.next(fields)) {
+            if (fields.size() == 1 && fields[0].empty()) continue;
+            fn(csv, fields);
+        }
+    }
+
+    /**
+     * @brief      
+     * @param line  
+     * @param name [out]  
+     * @return true   -  [Account:]
+     */
+    static bool parse_header(std::string_view line, std::string_view& name);
+};
@@ -0,0 +1,113 @@
+/**
+ * @file LedgerData.hpp
+ * @brief      
+ *
+ * @details  (CSV,  )     :
+ *   LedgerData,  FinanceCore    accounts.
+ *  :
+ * -      
+ * -     Account  
+ * -          
+ */
+
+#pragma once
+#include "../Time_Manager.hpp"
+#include "../TransactionStore.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+ /**
+  * @struct CurrencyTotals
+  * @brief         ( )
+  *
+  * @details    ,    
+  *     : 
+  *      
+  */
+struct CurrencyTotals {
+    std::string currency;  ///<  
+    Money income;          ///<  
+    Money expenses;        ///<   ()
+
+    Money net() const { return income - expenses; } ///<    
+};
+
+/**
+ * @brief    
+ * @param transactions  
+ * @return      
+ *
+ * @details    ,   .   
+ * ,        -
+ *  ,        
+ */
+inline std::vector<CurrencyTotals> sum_by_currency(const TransactionStore& transactions) {
+    const auto& amounts = transactions.amounts();
+    const auto& types = transactions.types();
+    const auto& currencies = transactions.currencies();
+
+    std::vector<CurrencyTotals> result;
+    std::vector<Symbol> codes;
+    size_t i = 0;
+    for (size_t row = 0; row < amounts.size(); ++row) {
+        const Symbol code = currencies[row];
+        if (i >= codes.size() || codes[i] != code) {
+            i = std::find(codes.begin(), codes.end(), code) - codes.begin();
+            if (i == codes.size()) {
+                codes.push_back(code);
+                result.push_back({ std::string(code.view()), Money(0, code), Money(0, code) });
+            }
+        }
+        (types[row] == Transaction::Type::INCOME ? result[i].income : result[i].expenses) += Money(amounts[row], code);
+    }
+    return result;
+}
+
+ /**
+  * @struct LedgerData
+  * @brief    
+  */
+struct LedgerData {
+    std::map<std::string, TransactionStore> accounts; ///<    
+    TransactionId max_id = 0; ///<   ID ( Transaction::id_allocator)
+    std::uint64_t journal_lsn = 0; ///<   ,   
+    std::map<std::string, std::uint64_t> generations; ///<     (. SegmentStore)
+
+    /**
+     * @brief   
+     * @return    
+     */
+    size_t transaction_count() const {
+        size_t total = 0;
+        for (const auto& [name, transactions] : accounts) {
+            total += transactions.size();
+        }
+        return total;
+    }
+};
+
+/**
+ * @struct LedgerView
+ * @brief      
+ *
+ * @details     (Account::snapshot())  
+ * :       
+ */
+struct LedgerView {
+    /**
+     * @brief   
+     */
+    struct Entry {
+        std::string name;                                          ///<  
+        std::shared_ptr<const TransactionStore> transactions;      ///<  
+        std::uint64_t generation = 0;                              ///< Account::generation()   
+    };
+
+    std::vector<Entry> accounts;   ///<    
+    std::uint64_t journal_lsn = 0; ///<   ,   
+};
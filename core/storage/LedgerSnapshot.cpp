@@ -0,0 +1,307 @@
+/**
+ * @file LedgerSnapshot.cpp
+ * @brief     
+ *
+ * @details     :
+ * 1.     
+ * 2.      
+ *
+ *      (MappedFile)   
+ *     ,   .
+ */
+
+#include "LedgerSnapshot.hpp"
+#include "BinaryCodec.hpp"
+#include "MappedFile.hpp"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
+namespace {
+
+    constexpr char MAGIC[8] = { 'M', 'K', 'L', 'E', 'D', 'G', 'E', 'R' }; ///<  
+    constexpr size_t MAX_TAGS_IN_RECORD = 5;     ///<    
+    constexpr size_t WRITE_CHUNK = 1 << 20;      ///<    
+
+    /**
+     * @brief    
+     * @note  string_view    -      
+     *
+     * @details   (Symbol)   
+     *    ,   
+     */
+    class StringTable {
+    public:
+        std::uint32_t intern(std::string_view s) {
+            auto [it, inserted] = index_.try_emplace(s, static_cast<std::uint32_t>(strings_.size()));
+            if (inserted) strings_.push_back(s);
+            return it->second;
+        }
+
+        std::uint32_t intern(Symbol s) {
+            if (s.id() >= by_symbol_.size()) by_symbol_.resize(s.id() + 1, NONE);
+            std::uint32_t& slot = by_symbol_[s.id()];
+            if (slot == NONE) slot = intern(s.view());
+            return slot;
+        }
+
+        std::uint32_t intern_tag(int bit) {
+            std::uint32_t& slot = by_tag_[bit];
+            if (slot == NONE) slot = intern(TagCatalogue::name(bit));
+            return slot;
+        }
+
+        std::uint32_t lookup(std::string_view s) const { return index_.at(s); }
+
+        std::uint32_t lookup(Symbol s) const { return by_symbol_.at(s.id()); }
+
+        std::uint32_t lookup_tag(int bit) const { return by_tag_[bit]; }
+
+        const std::vector<std::string_view>& strings() const { return strings_; }
+
+    private:
+        static constexpr std::uint32_t NONE = ~std::uint32_t{ 0 };
+
+        std::unordered_map<std::string_view, std::uint32_t> index_;
+        std::vector<std::string_view> strings_;
+        std::vector<std::uint32_t> by_symbol_; ///<    ->   
+        std::array<std::uint32_t, TagCatalogue::CAPACITY> by_tag_ = make_tag_slots(); ///<   ->   
+
+        static std::array<std::uint32_t, TagCatalogue::CAPACITY> make_tag_slots() {
+            std::array<std::uint32_t, TagCatalogue::CAPACITY> slots;
+            slots.fill(NONE);
+            return slots;
+        }
+    };
+
+} // namespace
+
+/**
+ * @brief    
+ * @param path    
+ * @param accounts   
+ * @param journal_lsn    ,   
+ *
+ * @details         write(path, view)
+ */
+void LedgerSnapshot::write(const std::string& path, const std::map<std::string, Account>& accounts,
+    std::uint64_t journal_lsn) {
+    LedgerView view;
+    view.journal_lsn = journal_lsn;
+    view.accounts.reserve(accounts.size());
+    for (const auto& [name, account] : accounts) {
+        view.accounts.push_back({ name, account.snapshot(), account.generation() });
+    }
+    write(path, view);
+}
+
+/**
+ * @brief     
+ * @param path    
+ * @param view  
+ *
+ * @details :
+ * 1.      
+ * 2.        
+ * 3.      WRITE_CHUNK 
+ * 4.     
+ *
+ * @throws std::runtime_error   -
+ */
+void LedgerSnapshot::write(const std::string& path, const LedgerView& view) {
+    StringTable table;
+    std::uint64_t transaction_count = 0;
+
+    for (const auto& entry : view.accounts) {
+        table.intern(entry.name);
+        const TransactionStore& store = *entry.transactions;
+        for (Symbol s : store.categories()) table.intern(s);
+        for (const auto& s : store.descriptions()) table.intern(s);
+        for (Symbol s : store.currencies()) table.intern(s);
+        for (TagMask tags : store.tag_masks()) {
+            for (TagMask m = tags; m != 0; m &= m - 1) table.intern_tag(TagCatalogue::lowest(m));
+        }
+        transaction_count += store.size();
+    }
+
+    const std::string tmp_path = path + ".tmp";
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!file) throw std::runtime_error("      ");
+
+    std::string buf;
+    buf.reserve(WRITE_CHUNK + RECORD_SIZE);
+    ByteWriter out(buf);
+    auto flush = [&file, &buf](bool force) {
+        if (force || buf.size() >= WRITE_CHUNK) {
+            file.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+            buf.clear();
+        }
+    };
+
+    // 
+    out.raw(MAGIC, sizeof(MAGIC));
+    out.u32(FORMAT_VERSION);
+    out.u32(RECORD_SIZE);
+    out.u32(static_cast<std::uint32_t>(table.strings().size()));
+    out.u32(static_cast<std::uint32_t>(view.accounts.size()));
+    out.u64(transaction_count);
+    out.u64(view.journal_lsn);
+
+    //  
+    for (std::string_view s : table.strings()) {
+        out.str(s);
+        flush(false);
+    }
+
+    //  
+    for (const auto& entry : view.accounts) {
+        out.u32(table.lookup(entry.name));
+        out.u32(0);
+        const TransactionStore& store = *entry.transactions;
+        out.u64(store.size());
+
+        for (size_t row = 0; row < store.size(); ++row) {
+            out.u64(static_cast<std::uint64_t>(store.ids()[row]));
+            out.u64(static_cast<std::uint64_t>(store.amounts()[row]));
+            out.u32(table.lookup(store.categories()[row]));
+            out.u32(table.lookup(store.descriptions()[row]));
+            out.u32(table.lookup(store.currencies()[row]));
+            const Date::YearMonthDay ymd = store.dates()[row].civil();
+            out.u16(static_cast<std::uint16_t>(ymd.year));
+            out.u8(static_cast<std::uint8_t>(ymd.month));
+            out.u8(static_cast<std::uint8_t>(ymd.day));
+            out.u8(static_cast<std::uint8_t>(store.types()[row]));
+            out.u8(static_cast<std::uint8_t>(TagCatalogue::count(store.tag_masks()[row])));
+            out.u16(0);
+            TagMask tags = store.tag_masks()[row];
+            for (size_t i = 0; i < MAX_TAGS_IN_RECORD; ++i, tags &= tags - 1) {
+                out.u32(tags != 0 ? table.lookup_tag(TagCatalogue::lowest(tags)) : 0);
+            }
+            flush(false);
+        }
+    }
+    flush(true);
+
+    file.close();
+    if (!file) throw std::runtime_error("   ");
+    std::filesystem::rename(tmp_path, path);
+}
+
+/**
+ * @brief     
+ * @param path    
+ * @return     ID
+ *
+ * @details    ,  
+ *   string_view  ,  
+ *       
+ *
+ * @throws std::runtime_error   ,   
+ */
+LedgerData LedgerSnapshot::read(const std::string& path) {
+    MappedFile file(path, MappedFile::Access::Sequential);
+    std::string_view raw = file.view();
+    ByteReader in(raw);
+
+    // 
+    const unsigned char* magic = in.take(sizeof(MAGIC));
+    if (std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("     ");
+    }
+    const std::uint32_t version = in.u32();
+    if (version < 1 || version > FORMAT_VERSION) {
+        throw std::runtime_error("  ");
+    }
+    if (in.u32() != RECORD_SIZE) {
+        throw std::runtime_error(" :   ");
+    }
+    const std::uint32_t string_count = in.u32();
+    const std::uint32_t account_count = in.u32();
+    in.u64(); //    -   
+
+    LedgerData data;
+    if (version >= 2) data.journal_lsn = in.u64();
+
+    //  
+    std::vector<std::string_view> strings;
+    strings.reserve(string_count);
+    for (std::uint32_t i = 0; i < string_count; ++i) {
+        strings.push_back(in.str());
+    }
+    auto str = [&strings](std::uint32_t index) -> std::string_view {
+        if (index >= strings.size()) throw std::runtime_error(" :    ");
+        return strings[index];
+    };
+    // ,         
+    std::vector<Symbol> symbols(string_count);
+    std::vector<bool> interned(string_count, false);
+    //     ,     
+    std::vector<int> tag_bits(string_count, -1);
+    auto tag_bit = [&](std::uint32_t index) -> TagMask {
+        std::string_view s = str(index);
+        if (tag_bits[index] < 0) tag_bits[index] = TagCatalogue::bit(s);
+        return TagMask(1) << tag_bits[index];
+    };
+    auto symbol = [&](std::uint32_t index) -> Symbol {
+        std::string_view s = str(index);
+        if (!interned[index]) {
+            symbols[index] = Symbol(s);
+            interned[index] = true;
+        }
+        return symbols[index];
+    };
+
+    for (std::uint32_t a = 0; a < account_count; ++a) {
+        std::string name(str(in.u32()));
+        in.u32();
+        std::uint64_t count = in.u64();
+        if (count > in.remaining() / RECORD_SIZE) throw std::runtime_error(" :   ");
+        const unsigned char* records = in.take(count * RECORD_SIZE);
+
+        auto& transactions = data.accounts[name];
+        transactions.reserve(transactions.size() + count);
+
+        for (std::uint64_t i = 0; i < count; ++i) {
+            const unsigned char* r = records + i * RECORD_SIZE;
+
+            auto id64 = static_cast<TransactionId>(ByteReader::load_u64(r));
+            if (id64 <= 0) {
+                throw std::runtime_error(" : ID  ");
+            }
+            if (r[32] > static_cast<std::uint8_t>(Transaction::Type::EXPENSE)) {
+                throw std::runtime_error(" :   ");
+            }
+            const std::uint64_t amount_bits = ByteReader::load_u64(r + 8);
+            std::int64_t amount = static_cast<std::int64_t>(amount_bits);
+            if (version < 3) {
+                double major;
+                std::memcpy(&major, &amount_bits, sizeof(major));
+                amount = Money::round_minor(major * Money::SCALE);
+            }
+
+            const std::uint8_t tag_count = r[33];
+            if (tag_count > MAX_TAGS_IN_RECORD) throw std::runtime_error(" :   ");
+            TagMask tags = 0;
+            for (std::uint8_t k = 0; k < tag_count; ++k) {
+                tags |= tag_bit(ByteReader::load_u32(r + 36 + 4 * k));
+            }
+
+            //        
+            const TransactionId id = id64;
+            transactions.emplace_back(id, amount,
+                static_cast<Transaction::Type>(r[32]),
+                Date(ByteReader::load_u16(r + 28), r[30], r[31]),
+                symbol(ByteReader::load_u32(r + 16)),
+                str(ByteReader::load_u32(r + 20)),
+                symbol(ByteReader::load_u32(r + 24)),
+                tags);
+            if (id > data.max_id) data.max_id = id;
+        }
+    }
+
+    if (!in.at_end()) throw std::runtime_error(" :     ");
+    return data;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file LedgerSnapshot.hpp
+ * @brief    
+ *
+ * @details    .    CSV:
+ * -    
+ * -   (, , , ,  )
+ *         
+ * -         
+ *
+ * @section snapshot_layout   (little-endian)
+ * 1.  (40 ): , ,  , ,
+ *         (  2)
+ * 2.  : [u32 ][] * string_count
+ * 3.  : [u32 ][u32 ][u64 ][]
+ *
+ * @section snapshot_record   (56 )
+ * |  |                        |
+ * |----------|----------------------------|
+ * | 0        | i64 id                     |
+ * | 8        | i64 amount (. )  |
+ * | 16       | u32 category ()      |
+ * | 20       | u32 description ()   |
+ * | 24       | u32 currency ()      |
+ * | 28       | u16 , u8 , u8  |
+ * | 32       | u8 type, u8      |
+ * | 36       | u32 [5] ()      |
+ *
+ *   3    -    
+ * (Money).   1-2  f64   : 
+ *      .
+ */
+
+#pragma once
+#include "LedgerData.hpp"
+#include "../Account.hpp"
+#include <cstdint>
+#include <map>
+#include <string>
+
+ /**
+  * @class LedgerSnapshot
+  * @brief     
+  *
+  * @note  :     ,
+  *     
+  */
+class LedgerSnapshot {
+public:
+    static constexpr std::uint32_t FORMAT_VERSION = 3;  ///<    (1 -   , 1-2 -  f64)
+    static constexpr std::uint32_t RECORD_SIZE = 56;    ///<     
+
+    /**
+     * @brief    
+     * @param path    
+     * @param accounts   
+     * @param journal_lsn    ,    
+     * @throws std::runtime_error   
+     *
+     * @note          
+     */
+    static void write(const std::string& path, const std::map<std::string, Account>& accounts,
+        std::uint64_t journal_lsn = 0);
+
+    /**
+     * @brief     
+     * @param path    
+     * @param view ,   Journal::freeze()
+     * @throws std::runtime_error   
+     *
+     * @note    Account,   
+     *       
+     */
+    static void write(const std::string& path, const LedgerView& view);
+
+    /**
+     * @brief     
+     * @param path    
+     * @return ,   
+     * @throws std::runtime_error       
+     */
+    static LedgerData read(const std::string& path);
+};
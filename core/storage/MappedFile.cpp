@@ -0,0 +1,112 @@
+/**
+ * @file MappedFile.cpp
+ * @brief     
+ */
+
+#include "MappedFile.hpp"
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MONEY_KEEPER_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <filesystem>
+#endif
+
+ /**
+  * @brief    
+  * @param path   
+  * @param access    
+  *
+  * @details    : view()   
+  * @throws std::runtime_error   open/fstat/mmap
+  */
+MappedFile::MappedFile(const std::string& path, Access access) {
+#ifdef MONEY_KEEPER_HAS_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("   : " + path);
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw std::runtime_error("    : " + path);
+    }
+
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ > 0) {
+        void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("     : " + path);
+        }
+        data_ = static_cast<const char*>(addr);
+    }
+    ::close(fd); //      
+    advise(access);
+#else
+    (void)access;
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw std::runtime_error("   : " + path);
+    fallback_.resize(static_cast<size_t>(std::filesystem::file_size(path)));
+    file.read(fallback_.data(), static_cast<std::streamsize>(fallback_.size()));
+    data_ = fallback_.data();
+    size_ = fallback_.size();
+#endif
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+    size_(std::exchange(other.size_, 0)),
+    fallback_(std::move(other.fallback_)) {
+    if (!fallback_.empty()) data_ = fallback_.data();
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        fallback_ = std::move(other.fallback_);
+        if (!fallback_.empty()) data_ = fallback_.data();
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    release();
+}
+
+/**
+ * @brief      
+ * @param access Sequential -    
+ *   , Random -  
+ */
+void MappedFile::advise(Access access) const {
+#ifdef MONEY_KEEPER_HAS_MMAP
+    if (data_ && size_ > 0) {
+        ::madvise(const_cast<char*>(data_), size_,
+            access == Access::Sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+    }
+#else
+    (void)access;
+#endif
+}
+
+/**
+ * @brief  
+ */
+void MappedFile::release() noexcept {
+#ifdef MONEY_KEEPER_HAS_MMAP
+    if (data_ && size_ > 0) {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    fallback_.clear();
+}
@@ -0,0 +1,74 @@
+/**
+ * @file MappedFile.hpp
+ * @brief       
+ *
+ * @details        :
+ * -     std::ifstream  std::string
+ * -        
+ * -      (madvise)
+ *
+ * @section mapped_platforms 
+ * - Linux/macOS: mmap + madvise
+ * - :      (  )
+ */
+
+#pragma once
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+ /**
+  * @class MappedFile
+  * @brief RAII-   
+  *
+  * @invariant view() ,   
+  * @note  ,  
+  */
+class MappedFile {
+public:
+    /**
+     * @enum Access
+     * @brief     
+     */
+    enum class Access {
+        Sequential, ///<       (MADV_SEQUENTIAL)
+        Random      ///<  ,    (MADV_RANDOM)
+    };
+
+    /**
+     * @brief    
+     * @param path   
+     * @param access    
+     * @throws std::runtime_error       
+     */
+    explicit MappedFile(const std::string& path, Access access = Access::Sequential);
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile();
+
+    /**
+     * @brief     
+     * @param access  
+     * @note      madvise
+     */
+    void advise(Access access) const;
+
+    /**
+     * @brief  
+     * @return    
+     */
+    std::string_view view() const { return { data_, size_ }; }
+
+    size_t size() const { return size_; } ///<    
+
+private:
+    void release() noexcept;
+
+    const char* data_ = nullptr; ///<  
+    size_t size_ = 0;            ///<  
+    std::string fallback_;       ///<     mmap
+};
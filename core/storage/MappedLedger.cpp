@@ -0,0 +1,51 @@
+/**
+ * @file MappedLedger.cpp
+ * @brief    CSV-
+ */
+
+#include "MappedLedger.hpp"
+#include <iostream>
+
+ /**
+  * @brief    
+  * @param path   CSV-
+  *
+  * @details     ,
+  *        
+  */
+MappedLedger::MappedLedger(const std::string& path)
+    : file_(path, MappedFile::Access::Sequential) {
+    std::vector<TransactionView>* current = &accounts_[""];
+
+    LedgerCsv::for_each_record(file_.view(), [&](const CsvTokenizer& csv, const std::vector<std::string_view>& fields) {
+        std::string_view name;
+        if (LedgerCsv::parse_header(csv.record(), name)) {
+            current = &accounts_[std::string(name)];
+            return;
+        }
+        try {
+            TransactionView view = LedgerCsv::parse_record(fields);
+            for (std::string_view* field : { &view.category, &view.currency, &view.description, &view.tags }) {
+                if (csv.is_transient(*field)) *field = unescaped_.emplace_back(*field);
+            }
+            current->push_back(view);
+        }
+        catch (const std::exception& e) {
+            std::cerr << "  : " << e.what()
+                << "\n " << csv.line() << ": " << csv.record() << "\n";
+        }
+        });
+
+    file_.advise(MappedFile::Access::Random);
+}
+
+/**
+ * @brief      
+ */
+size_t MappedLedger::transaction_count() const {
+    size_t total = 0;
+    for (const auto& [name, views] : accounts_) {
+        total += views.size();
+    }
+    return total;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file MappedLedger.hpp
+ * @brief   CSV-    
+ *
+ * @details    ,   
+ *  TransactionView -  ,   
+ *  .      ,
+ *        ,  
+ *     (     ).
+ */
+
+#pragma once
+#include "LedgerCsv.hpp"
+#include "MappedFile.hpp"
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+ /**
+  * @class MappedLedger
+  * @brief Read-only  CSV- 
+  *
+  * @invariant  TransactionView ,   
+  */
+class MappedLedger {
+public:
+    /**
+     * @brief    
+     * @param path   CSV-
+     * @throws std::runtime_error     
+     *
+     * @note       stderr
+     */
+    explicit MappedLedger(const std::string& path);
+
+    /**
+     * @brief    
+     * @return    
+     */
+    const std::map<std::string, std::vector<TransactionView>>& accounts() const { return accounts_; }
+
+    /**
+     * @brief   
+     */
+    size_t transaction_count() const;
+
+    /**
+     * @brief     
+     * @param view   accounts()
+     * @return  
+     */
+    static Transaction materialize(const TransactionView& view) { return LedgerCsv::to_transaction(view); }
+
+private:
+    MappedFile file_; ///< ,    
+    std::map<std::string, std::vector<TransactionView>> accounts_; ///<    
+    std::deque<std::string> unescaped_; ///<   "" (deque     )
+};
@@ -0,0 +1,34 @@
+/**
+ * @file Parallel.hpp
+ * @brief      
+ *
+ * @details  CSV      
+ *    .    
+ *  :  ,   .
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+ /**
+  * @brief  fn(i)  i  [0, tasks)  threads 
+  * @param tasks  
+  * @param threads   ( )
+  * @param fn ;     
+  *
+  * @note      
+  */
+template <typename Fn>
+void run_parallel(size_t tasks, unsigned threads, Fn&& fn) {
+    std::atomic<size_t> next{ 0 };
+    auto worker = [&] {
+        for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < tasks;) fn(i);
+    };
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads && t < tasks; ++t) pool.emplace_back(worker);
+    worker();
+    for (auto& thread : pool) thread.join();
+}
@@ -0,0 +1,356 @@
+/**
+ * @file SegmentStore.cpp
+ * @brief    
+ *
+ * @details   -  .  
+ *           
+ * ;       
+ * .        .
+ */
+
+#include "SegmentStore.hpp"
+#include "BinaryCodec.hpp"
+#include "LedgerSnapshot.hpp"
+#include "MappedFile.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    constexpr char MAGIC[8] = { 'M', 'K', 'M', 'A', 'N', 'I', 'F', 'S' }; ///<  
+    constexpr const char* SEGMENT_EXTENSION = ".seg"; ///<   
+
+    /**
+     * @brief    tasks 
+     */
+    unsigned thread_count(unsigned threads, size_t tasks) {
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        return static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(tasks, 1)));
+    }
+
+    /**
+     * @brief      
+     */
+    template <typename Segment>
+    void summarize(const TransactionStore& transactions, Segment& segment) {
+        for (TransactionId id : transactions.ids()) {
+            segment.max_id = std::max(segment.max_id, id);
+        }
+        segment.totals = sum_by_currency(transactions);
+    }
+
+} // namespace
+
+SegmentStore::SegmentStore(std::string directory) : directory_(std::move(directory)) {}
+
+std::string SegmentStore::manifest_path() const {
+    return (std::filesystem::path(directory_) / "MANIFEST").string();
+}
+
+std::string SegmentStore::segment_path(std::uint64_t file) const {
+    std::string name = std::to_string(file);
+    if (name.size() < 6) name.insert(0, 6 - name.size(), '0');
+    return (std::filesystem::path(directory_) / (name + SEGMENT_EXTENSION)).string();
+}
+
+bool SegmentStore::exists() const {
+    return std::filesystem::exists(manifest_path());
+}
+
+/**
+ * @brief    
+ *
+ * @details  1   :  max_id  totals
+ *  
+ */
+SegmentStore::Manifest SegmentStore::load_manifest() const {
+    MappedFile file(manifest_path(), MappedFile::Access::Sequential);
+    const std::string_view raw = file.view();
+    if (raw.size() < sizeof(MAGIC) + 4) throw std::runtime_error(" :   ");
+
+    ByteReader crc_reader(raw.substr(raw.size() - 4));
+    if (crc_reader.u32() != crc32(raw.data(), raw.size() - 4)) {
+        throw std::runtime_error(" :   ");
+    }
+
+    ByteReader in(raw.substr(0, raw.size() - 4));
+    if (std::memcmp(in.take(sizeof(MAGIC)), MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("     ");
+    }
+
+    Manifest manifest;
+    manifest.version = in.u32();
+    if (manifest.version < 1 || manifest.version > FORMAT_VERSION) {
+        throw std::runtime_error("  ");
+    }
+    const std::uint32_t account_count = in.u32();
+    manifest.journal_lsn = in.u64();
+    manifest.next_file = in.u64();
+
+    manifest.entries.reserve(account_count);
+    for (std::uint32_t i = 0; i < account_count; ++i) {
+        std::string name(in.str());
+        Segment segment;
+        segment.file = in.u64();
+        segment.generation = in.u64();
+        segment.transactions = in.u64();
+        if (manifest.version >= 2) {
+            segment.max_id = static_cast<TransactionId>(in.u64());
+            const std::uint32_t currencies = in.u32();
+            segment.totals.reserve(currencies);
+            for (std::uint32_t c = 0; c < currencies; ++c) {
+                CurrencyTotals totals;
+                totals.currency = std::string(in.str());
+                const Symbol code(totals.currency);
+                if (manifest.version >= 3) {
+                    totals.income = Money(static_cast<std::int64_t>(in.u64()), code);
+                    totals.expenses = Money(static_cast<std::int64_t>(in.u64()), code);
+                }
+                else {
+                    totals.income = Money::from_double(in.f64(), code);
+                    totals.expenses = Money::from_double(in.f64(), code);
+                }
+                segment.totals.push_back(std::move(totals));
+            }
+        }
+        if (segment.file >= manifest.next_file) throw std::runtime_error(" :   ");
+        manifest.entries.emplace_back(std::move(name), std::move(segment));
+    }
+    if (!in.at_end()) throw std::runtime_error(" :  ");
+    return manifest;
+}
+
+/**
+ * @brief      
+ */
+void SegmentStore::remember(const Manifest& manifest) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    manifest_.clear();
+    for (const auto& [name, segment] : manifest.entries) manifest_.emplace(name, segment);
+    next_file_ = manifest.next_file;
+}
+
+/**
+ * @brief     
+ * @param threads  
+ * @return  
+ *
+ * @details     ;
+ *       
+ */
+LedgerData SegmentStore::read(unsigned threads) {
+    Manifest manifest = load_manifest();
+    const auto& entries = manifest.entries;
+
+    LedgerData data;
+    data.journal_lsn = manifest.journal_lsn;
+
+    std::vector<LedgerData> parts(entries.size());
+    std::vector<std::string> errors(entries.size());
+    run_parallel(entries.size(), thread_count(threads, entries.size()), [&](size_t i) {
+        try {
+            parts[i] = LedgerSnapshot::read(segment_path(entries[i].second.file));
+        }
+        catch (const std::exception& e) {
+            errors[i] = e.what();
+        }
+        });
+
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (!errors[i].empty()) {
+            throw std::runtime_error("  " + entries[i].first + ": " + errors[i]);
+        }
+        auto& rows = data.accounts[entries[i].first];
+        for (auto& [name, transactions] : parts[i].accounts) {
+            rows.append(std::move(transactions));
+        }
+        data.max_id = std::max(data.max_id, parts[i].max_id);
+        data.generations[entries[i].first] = entries[i].second.generation;
+    }
+
+    remember(manifest);
+    return data;
+}
+
+/**
+ * @brief   
+ * @return  
+ */
+SegmentStore::Index SegmentStore::read_index() {
+    Manifest manifest = load_manifest();
+
+    Index index;
+    index.journal_lsn = manifest.journal_lsn;
+    index.complete = manifest.version >= 2;
+    index.accounts.reserve(manifest.entries.size());
+    for (const auto& [name, segment] : manifest.entries) {
+        index.accounts.push_back({ name, segment.transactions, segment.generation,
+            segment.max_id, segment.totals });
+        index.max_id = std::max(index.max_id, segment.max_id);
+    }
+
+    remember(manifest);
+    return index;
+}
+
+/**
+ * @brief    
+ * @param name  
+ * @return  
+ */
+TransactionStore SegmentStore::read_account(const std::string& name) const {
+    std::uint64_t file = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = manifest_.find(name);
+        if (it == manifest_.end()) throw std::runtime_error(" " + name + "   ");
+        file = it->second.file;
+    }
+
+    LedgerData part = LedgerSnapshot::read(segment_path(file));
+    TransactionStore rows;
+    for (auto& [account, transactions] : part.accounts) {
+        rows.append(std::move(transactions));
+    }
+    return rows;
+}
+
+/**
+ * @brief   
+ * @param view    
+ * @param threads  
+ * @return  
+ */
+SegmentStore::WriteStats SegmentStore::write(const LedgerView& view, unsigned threads) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::filesystem::create_directories(directory_);
+
+    WriteStats stats;
+    std::map<std::string, Segment> next;
+    std::vector<const LedgerView::Entry*> dirty;
+    std::vector<std::uint64_t> files;
+    std::uint64_t next_file = next_file_;
+
+    for (const auto& entry : view.accounts) {
+        auto it = manifest_.find(entry.name);
+        if (it != manifest_.end() && it->second.generation == entry.generation) {
+            next.emplace(entry.name, it->second);
+            ++stats.reused;
+            continue;
+        }
+        if (!entry.transactions) {
+            throw std::logic_error("  " + entry.name + "  ");
+        }
+        Segment segment;
+        segment.file = next_file++;
+        segment.generation = entry.generation;
+        segment.transactions = entry.transactions->size();
+        summarize(*entry.transactions, segment);
+        next.emplace(entry.name, std::move(segment));
+        dirty.push_back(&entry);
+        files.push_back(segment.file);
+    }
+
+    //   :  -     
+    std::vector<std::string> errors(dirty.size());
+    std::vector<std::uint64_t> sizes(dirty.size(), 0);
+    run_parallel(dirty.size(), thread_count(threads, dirty.size()), [&](size_t i) {
+        try {
+            LedgerView one;
+            one.accounts.push_back(*dirty[i]);
+            const std::string path = segment_path(files[i]);
+            LedgerSnapshot::write(path, one);
+            sizes[i] = std::filesystem::file_size(path);
+        }
+        catch (const std::exception& e) {
+            errors[i] = e.what();
+        }
+        });
+    for (size_t i = 0; i < dirty.size(); ++i) {
+        if (!errors[i].empty()) {
+            throw std::runtime_error("  " + dirty[i]->name + ": " + errors[i]);
+        }
+        stats.bytes += sizes[i];
+    }
+    stats.written = dirty.size();
+
+    //   :     
+    next_file_ = next_file;
+    stats.bytes += write_manifest(next, view.journal_lsn);
+    manifest_ = std::move(next);
+    remove_orphans();
+    return stats;
+}
+
+/**
+ * @brief     
+ * @return    
+ */
+std::uint64_t SegmentStore::write_manifest(const std::map<std::string, Segment>& segments,
+    std::uint64_t journal_lsn) const {
+    std::string buf;
+    ByteWriter out(buf);
+    out.raw(MAGIC, sizeof(MAGIC));
+    out.u32(FORMAT_VERSION);
+    out.u32(static_cast<std::uint32_t>(segments.size()));
+    out.u64(journal_lsn);
+    out.u64(next_file_);
+    for (const auto& [name, segment] : segments) {
+        out.str(name);
+        out.u64(segment.file);
+        out.u64(segment.generation);
+        out.u64(segment.transactions);
+        out.u64(static_cast<std::uint64_t>(segment.max_id));
+        out.u32(static_cast<std::uint32_t>(segment.totals.size()));
+        for (const auto& totals : segment.totals) {
+            out.str(totals.currency);
+            out.u64(static_cast<std::uint64_t>(totals.income.minor_units()));
+            out.u64(static_cast<std::uint64_t>(totals.expenses.minor_units()));
+        }
+    }
+    out.u32(crc32(buf.data(), buf.size()));
+
+    const std::string path = manifest_path();
+    const std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) throw std::runtime_error("     ");
+        file.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+        file.close();
+        if (!file) throw std::runtime_error("  ");
+    }
+    std::filesystem::rename(tmp_path, path);
+    return buf.size();
+}
+
+/**
+ * @brief  ,    
+ *
+ * @details      ,
+ *    
+ */
+void SegmentStore::remove_orphans() const {
+    std::vector<std::string> live;
+    live.reserve(manifest_.size());
+    for (const auto& [name, segment] : manifest_) {
+        live.push_back(std::filesystem::path(segment_path(segment.file)).filename().string());
+    }
+    std::sort(live.begin(), live.end());
+
+    std::error_code ec;
+    for (const auto& item : std::filesystem::directory_iterator(directory_, ec)) {
+        const auto& path = item.path();
+        const std::string ext = path.extension().string();
+        if (ext != SEGMENT_EXTENSION && ext != ".tmp") continue;
+        if (ext == ".tmp" || !std::binary_search(live.begin(), live.end(), path.filename().string())) {
+            std::filesystem::remove(path, ec);
+        }
+    }
+}
@@ -0,0 +1,177 @@
+/**
+ * @file SegmentStore.hpp
+ * @brief   :    + 
+ *
+ * @details         
+ *  - ( LedgerSnapshot   ).
+ *       (Account::generation()),
+ *     .    
+ * ,   , -   .
+ *
+ * @section segment_layout  
+ * - MANIFEST -   (  temp + rename)
+ * - NNNNNN.seg - ;      ,
+ *          
+ *
+ * @section manifest_layout  (little-endian)
+ * 1.  (8 ), u32 , u32  
+ * 2. u64     , u64   
+ * 3.   : [str ][u64 ][u64 ][u64 ]
+ *    [i64  ID][u32  ]{[str ][i64 ][i64 ]}
+ * 4. u32 CRC-32   
+ *
+ *  ID     (  2)  :
+ *         , 
+ *      (read_account()).
+ *   1 ,     .   3
+ *      ;   2  f64
+ *   ,    .
+ */
+
+#pragma once
+#include "LedgerData.hpp"
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+ /**
+  * @class SegmentStore
+  * @brief      
+  *
+  * @note  ;    
+  */
+class SegmentStore {
+public:
+    static constexpr std::uint32_t FORMAT_VERSION = 3; ///<  
+
+    /**
+     * @brief    
+     */
+    struct AccountIndex {
+        std::string name;                   ///<  
+        std::uint64_t transactions = 0;     ///<  
+        std::uint64_t generation = 0;       ///<    
+        TransactionId max_id = 0;           ///<  ID 
+        std::vector<CurrencyTotals> totals; ///<   
+    };
+
+    /**
+     * @brief   -  
+     */
+    struct Index {
+        std::vector<AccountIndex> accounts; ///<    
+        std::uint64_t journal_lsn = 0;      ///<   ,   
+        TransactionId max_id = 0;           ///<  ID   
+        bool complete = false;              ///< false    1 (   ID)
+    };
+
+    /**
+     * @brief   
+     */
+    struct WriteStats {
+        size_t written = 0;        ///<  
+        size_t reused = 0;         ///<   
+        std::uint64_t bytes = 0;   ///<   (  )
+    };
+
+    /**
+     * @brief    
+     * @param directory  (   )
+     */
+    explicit SegmentStore(std::string directory);
+
+    /**
+     * @brief ,   
+     */
+    bool exists() const;
+
+    /**
+     * @brief   
+     * @param threads   (0 -   )
+     * @return   ,     
+     * @throws std::runtime_error     
+     *
+     * @post  :   
+     *  ,    
+     */
+    LedgerData read(unsigned threads = 0);
+
+    /**
+     * @brief   
+     * @return  
+     * @throws std::runtime_error   
+     *
+     * @post    read(),    
+     */
+    Index read_index();
+
+    /**
+     * @brief    
+     * @param name  
+     * @return        
+     * @throws std::runtime_error        
+     *
+     * @note ,    ,   
+     *    ,    
+     *   (    )
+     */
+    TransactionStore read_account(const std::string& name) const;
+
+    /**
+     * @brief  ,    
+     * @param view    
+     * @param threads   (0 -   )
+     * @return     
+     * @throws std::runtime_error    (  )
+     *
+     * @details :
+     * 1.       ,   , 
+     * 2.      
+     * 3.        
+     * 4. ,      , 
+     *
+     * @throws std::logic_error      
+     */
+    WriteStats write(const LedgerView& view, unsigned threads = 0);
+
+    /**
+     * @brief  
+     */
+    const std::string& directory() const { return directory_; }
+
+private:
+    /**
+     * @brief     
+     */
+    struct Segment {
+        std::uint64_t file = 0;         ///<   
+        std::uint64_t generation = 0;   ///<    
+        std::uint64_t transactions = 0; ///<  
+        TransactionId max_id = 0;       ///<  ID 
+        std::vector<CurrencyTotals> totals; ///<   
+    };
+
+    /**
+     * @brief  
+     */
+    struct Manifest {
+        std::uint32_t version = 0;      ///<  
+        std::uint64_t journal_lsn = 0;  ///<  
+        std::uint64_t next_file = 1;    ///<   
+        std::vector<std::pair<std::string, Segment>> entries; ///<    
+    };
+
+    std::string segment_path(std::uint64_t file) const;
+    std::string manifest_path() const;
+    Manifest load_manifest() const;
+    void remember(const Manifest& manifest);
+    std::uint64_t write_manifest(const std::map<std::string, Segment>& segments, std::uint64_t journal_lsn) const;
+    void remove_orphans() const;
+
+    std::string directory_;                    ///<  
+    mutable std::mutex mutex_;                 ///<  
+    std::map<std::string, Segment> manifest_;  ///<     
+    std::uint64_t next_file_ = 1;              ///<    
+};
@@ -0,0 +1,106 @@
+/**
+ * @file SnapshotCompactor.cpp
+ * @brief    
+ */
+
+#include "SnapshotCompactor.hpp"
+#include <algorithm>
+#include <iostream>
+
+SnapshotCompactor::SnapshotCompactor(Journal& journal, SegmentStore& store, Capture capture,
+    std::chrono::milliseconds interval, std::uint64_t threshold)
+    : journal_(journal), store_(store), capture_(std::move(capture)),
+    interval_(interval), threshold_(threshold) {
+    worker_ = std::thread(&SnapshotCompactor::run, this);
+}
+
+SnapshotCompactor::~SnapshotCompactor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_one();
+    if (worker_.joinable()) worker_.join();
+}
+
+void SnapshotCompactor::request() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        requested_ = true;
+    }
+    wake_.notify_one();
+}
+
+SnapshotCompactor::Stats SnapshotCompactor::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+/**
+ * @brief   
+ *
+ * @details :
+ * 1.  Journal::freeze()       ()
+ * 2.   ,    ,
+ *      (SegmentStore::write)
+ * 3.       <=  
+ *
+ * @note   ,     , 
+ *  :       
+ */
+void SnapshotCompactor::compact() {
+    using clock = std::chrono::steady_clock;
+    std::lock_guard<std::mutex> serial(compact_mutex_);
+
+    const auto pause_start = clock::now();
+    LedgerView view;
+    {
+        auto cut = journal_.freeze();
+        view = capture_();
+        view.journal_lsn = journal_.last_lsn();
+    }
+    const auto pause_end = clock::now();
+
+    const SegmentStore::WriteStats written = store_.write(view);
+    view.accounts.clear(); //  ,     
+    const std::uint64_t reclaimed = journal_.compact_through(view.journal_lsn);
+    const auto done = clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.runs;
+    stats_.bytes_reclaimed += reclaimed;
+    stats_.last_bytes_reclaimed = reclaimed;
+    stats_.last_pause_ms = std::chrono::duration<double, std::milli>(pause_end - pause_start).count();
+    stats_.max_pause_ms = std::max(stats_.max_pause_ms, stats_.last_pause_ms);
+    stats_.last_write_ms = std::chrono::duration<double, std::milli>(done - pause_end).count();
+    stats_.snapshot_lsn = view.journal_lsn;
+    stats_.last_segments_written = written.written;
+    stats_.last_segments_reused = written.reused;
+}
+
+/**
+ * @brief   
+ *
+ * @details   interval_ (  request())   
+ *   ,       
+ */
+void SnapshotCompactor::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait_for(lock, interval_, [this] { return stop_ || requested_; });
+        if (stop_) break;
+        const bool forced = requested_;
+        requested_ = false;
+
+        lock.unlock();
+        if (forced || journal_.size() >= threshold_) {
+            try {
+                compact();
+            }
+            catch (const std::exception& e) {
+                std::cerr << " : " << e.what() << "\n";
+            }
+        }
+        lock.lock();
+    }
+}
@@ -0,0 +1,108 @@
+/**
+ * @file SnapshotCompactor.hpp
+ * @brief     
+ *
+ * @details     .  :
+ * 1.      Journal::freeze()
+ *    (     -    )
+ * 2.       (SegmentStore)
+ * 3.    ,   
+ *
+ *  2-3        :
+ *      (copy-on-write),   .
+ */
+
+#pragma once
+#include "Journal.hpp"
+#include "LedgerData.hpp"
+#include "SegmentStore.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+ /**
+  * @class SnapshotCompactor
+  * @brief ,    
+  *
+  * @note        
+  */
+class SnapshotCompactor {
+public:
+    /**
+     * @brief  
+     */
+    struct Stats {
+        std::uint64_t runs = 0;                 ///<  
+        std::uint64_t bytes_reclaimed = 0;      ///<    ()
+        std::uint64_t last_bytes_reclaimed = 0; ///<   
+        double last_pause_ms = 0.0;             ///<     
+        double max_pause_ms = 0.0;              ///<  
+        double last_write_ms = 0.0;             ///<     
+        std::uint64_t snapshot_lsn = 0;         ///<    
+        size_t last_segments_written = 0;       ///<    
+        size_t last_segments_reused = 0;        ///<      
+    };
+
+    /**
+     * @brief  ;   Journal::freeze()
+     * @note journal_lsn  SnapshotCompactor
+     */
+    using Capture = std::function<LedgerView()>;
+
+    /**
+     * @brief   
+     * @param journal  
+     * @param store  
+     * @param capture   
+     * @param interval    
+     * @param threshold    ,    
+     */
+    SnapshotCompactor(Journal& journal, SegmentStore& store, Capture capture,
+        std::chrono::milliseconds interval = std::chrono::seconds(30),
+        std::uint64_t threshold = 4u << 20);
+
+    /**
+     * @brief   (    )
+     */
+    ~SnapshotCompactor();
+
+    SnapshotCompactor(const SnapshotCompactor&) = delete;
+    SnapshotCompactor& operator=(const SnapshotCompactor&) = delete;
+
+    /**
+     * @brief        
+     */
+    void request();
+
+    /**
+     * @brief     
+     * @throws std::runtime_error      
+     */
+    void compact();
+
+    /**
+     * @brief  
+     */
+    Stats stats() const;
+
+private:
+    void run();
+
+    Journal& journal_;                      ///<  
+    SegmentStore& store_;                   ///<  
+    Capture capture_;                       ///<  
+    std::chrono::milliseconds interval_;    ///<  
+    std::uint64_t threshold_;               ///<   
+
+    std::mutex compact_mutex_;              ///<      
+    mutable std::mutex mutex_;              ///<   
+    std::condition_variable wake_;          ///<  
+    bool stop_ = false;                     ///<  
+    bool requested_ = false;                ///<   
+    Stats stats_;                           ///< 
+
+    std::thread worker_;                    ///<  
+};
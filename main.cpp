@@ -15,7 +15,9 @@
 
 #pragma once
 #define _CRT_SECURE_NO_WARNINGS  // Отключает предупреждения безопасности CRT для MSVC
+#ifdef _WIN32
 #include <Windows.h>             // Заголовочный файл для Windows API
+#endif
 #include <clocale>               // Для работы с локализацией
 #include <iostream>              // Стандартный ввод/вывод
 #include "core/FinanceCore.hpp"  // Основной класс приложения